@@ -0,0 +1,289 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "data/AircraftData.h"
+#include "object/Aircraft.h"
+#include "object/GpsPosition.h"
+#include "object/TimeStamp.hpp"
+#include "object/Wind.h"
+#include "object/impl/DateTimeImplBoost.h"
+#include "util/FlatIndex.h"
+
+#include "Benchmark.hpp"
+
+using namespace data;
+using namespace object;
+
+namespace
+{
+/// Updates per producer thread
+constexpr std::size_t UPDATES = 200000;
+
+/// Distinct aircrafts per producer thread
+constexpr std::size_t AIRCRAFTS = 256;
+
+/// Serve cycles per store size
+constexpr std::size_t CYCLES = 50;
+
+/// The reference position
+const Position REFERENCE{49.0, 8.0, 0};
+
+/**
+ * @brief Create distinct FLARM targets scattered around the reference position.
+ * @param targets The amount of targets
+ * @return the targets
+ */
+std::vector<Aircraft> scatter(std::size_t targets)
+{
+    std::vector<Aircraft> aircrafts(targets);
+    for (std::size_t i = 0; i < targets; ++i)
+    {
+        aircrafts[i].set_id(static_cast<std::uint32_t>(i));
+        aircrafts[i].set_fullInfo(true);
+        aircrafts[i].set_targetType(Aircraft::TargetType::FLARM);
+        aircrafts[i].set_position({REFERENCE.latitude + static_cast<double>(i % 100) / 200.0,
+                                   REFERENCE.longitude + static_cast<double>(i / 100 % 100) / 200.0,
+                                   static_cast<std::int32_t>(500 + i % 3000)});
+        aircrafts[i].set_movement({95.0, static_cast<double>(i % 360), -1.3});
+    }
+    return aircrafts;
+}
+
+/**
+ * @brief Create distinct FLARM targets spread over Europe, like the traffic of an OGN server.
+ * @param targets The amount of targets
+ * @return the targets
+ */
+std::vector<Aircraft> spread(std::size_t targets)
+{
+    std::vector<Aircraft>                  aircrafts(scatter(targets));
+    std::mt19937                           gen(42);
+    std::uniform_real_distribution<double> latitude(36.0, 70.0);
+    std::uniform_real_distribution<double> longitude(-10.0, 40.0);
+    for (auto& it : aircrafts)
+    {
+        it.set_position({latitude(gen), longitude(gen), it.get_position().altitude});
+    }
+    return aircrafts;
+}
+
+/**
+ * @brief Get a strictly increasing timestamp per serve cycle.
+ * @param cycle The cycle
+ * @return the timestamp
+ */
+TimeStamp<timestamp::DateTimeImplBoost> cycleTime(std::size_t cycle)
+{
+    char value[16];
+    std::snprintf(value, sizeof(value), "00:%02zu:%02zu.%03zu", cycle / 60000 % 60,
+                  cycle / 1000 % 60, cycle % 1000);
+    return TimeStamp<timestamp::DateTimeImplBoost>(value, timestamp::Format::HH_MM_SS_FFF);
+}
+
+/**
+ * @brief Update every target with a newer report.
+ * @param data      The aircraft store
+ * @param aircrafts The targets, whose timestamp is advanced
+ * @param cycle     The cycle
+ */
+void updateAll(AircraftData& data, std::vector<Aircraft>& aircrafts, std::size_t cycle)
+{
+    auto time = cycleTime(cycle);
+    for (auto& it : aircrafts)
+    {
+        it.set_timeStamp(time);
+        Aircraft update(it);
+        data.update(std::move(update));
+    }
+}
+
+/**
+ * @brief Let producers update aircrafts, while the serve cycle processes and serializes.
+ * @param data      The aircraft store
+ * @param producers The amount of producer threads
+ * @param queued    Whether to pass updates through the ingest queue
+ */
+void contend(AircraftData& data, std::size_t producers, bool queued)
+{
+    std::atomic<bool>        running(true);
+    std::vector<std::thread> threads;
+    std::thread              serve([&] {
+        std::string dest;
+        while (running)
+        {
+            dest.clear();
+            data.flush();
+            data.processAircrafts({49.0, 8.0, 0}, 1013.25);
+            data.get_serialized(dest);
+            bench::doNotOptimize(dest);
+        }
+    });
+    for (std::size_t p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&data, p, queued] {
+            std::vector<Aircraft> prototypes(AIRCRAFTS);
+            for (std::size_t i = 0; i < AIRCRAFTS; ++i)
+            {
+                prototypes[i].set_id(static_cast<std::uint32_t>(p * AIRCRAFTS + i));
+                prototypes[i].set_position({49.0, 8.0, 1000});
+            }
+            for (std::size_t i = 0; i < UPDATES; ++i)
+            {
+                Aircraft update(prototypes[i % AIRCRAFTS]);
+                if (queued)
+                {
+                    data.enqueue(std::move(update));
+                }
+                else
+                {
+                    data.update(std::move(update));
+                }
+            }
+        });
+    }
+    for (auto& it : threads)
+    {
+        it.join();
+    }
+    running = false;
+    serve.join();
+}
+}  // namespace
+
+void bench_aircraft_data(bench::Runner& runner)
+{
+    for (std::size_t targets : {std::size_t(10), std::size_t(1000), std::size_t(10000)})
+    {
+        const std::string     suffix = " " + std::to_string(targets) + " targets";
+        std::vector<Aircraft> aircrafts(scatter(targets));
+        AircraftData          data(std::numeric_limits<std::int32_t>::max());
+        std::string           dest;
+        std::size_t           cycle = 1;
+
+        updateAll(data, aircrafts, cycle++);
+        runner
+            .runOnce("aircraftdata/update" + suffix, CYCLES * targets,
+                     [&] {
+                         for (std::size_t i = 0; i < CYCLES; ++i)
+                         {
+                             updateAll(data, aircrafts, cycle++);
+                         }
+                     })
+            .runOnce("aircraftdata/update+processAircrafts" + suffix, CYCLES,
+                     [&] {
+                         for (std::size_t i = 0; i < CYCLES; ++i)
+                         {
+                             updateAll(data, aircrafts, cycle++);
+                             data.processAircrafts(REFERENCE, 1013.25);
+                         }
+                     })
+            .run("aircraftdata/get_serialized" + suffix, CYCLES,
+                 [&](std::size_t) {
+                     dest.clear();
+                     data.get_serialized(dest);
+                     bench::doNotOptimize(dest);
+                 })
+            // nothing due, so only the pass over all stored records
+            .run("aircraftdata/processAircrafts none due" + suffix, CYCLES, [&](std::size_t) {
+                data.processAircrafts(REFERENCE, 1013.25, false);
+            });
+    }
+
+    // the store's index alone, with addresses as scattered as real ones
+    {
+        std::mt19937                                 gen(42);
+        std::uniform_int_distribution<std::uint32_t> address(0, 0xFFFFFF);
+        std::vector<std::uint32_t>                   keys(10000);
+        util::FlatIndex                              index;
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            keys[i] = address(gen);
+            index.set(keys[i], static_cast<std::uint32_t>(i));
+        }
+        runner
+            .run("flatindex/find hit 10000 keys", CYCLES * keys.size(),
+                 [&](std::size_t i) { bench::doNotOptimize(index.find(keys[i % keys.size()])); })
+            .run("flatindex/find miss 10000 keys", CYCLES * keys.size(), [&](std::size_t i) {
+                bench::doNotOptimize(index.find(keys[i % keys.size()] ^ 0x800000));
+            });
+    }
+
+    // the arbitration of a single update alone, as done by the stores
+    {
+        Aircraft stored(scatter(1).front());
+        Aircraft stale(stored);
+        Wind     wind;
+        Wind     windUpdate;
+        stored.set_timeStamp(cycleTime(2));
+        stale.set_timeStamp(cycleTime(1));
+        runner
+            .run("object/Aircraft::tryUpdate rejected", UPDATES,
+                 [&](std::size_t) { bench::doNotOptimize(stored.tryUpdate(std::move(stale))); })
+            .run("object/Wind::tryUpdate accepted", UPDATES, [&](std::size_t) {
+                bench::doNotOptimize(wind.tryUpdate(std::move(windUpdate)));
+            });
+    }
+
+    // a continent-wide feed, of which only few targets are in range
+    for (std::int32_t maxDist : {std::numeric_limits<std::int32_t>::max(), 40000})
+    {
+        const std::string suffix =
+            maxDist == 40000 ? " continent 40km" : " continent unfiltered";
+        std::vector<Aircraft> aircrafts(spread(10000));
+        AircraftData          data(maxDist);
+        std::size_t           cycle = 1;
+
+        data.processAircrafts(REFERENCE, 1013.25);
+        runner.runOnce("aircraftdata/update+processAircrafts" + suffix, CYCLES, [&] {
+            for (std::size_t i = 0; i < CYCLES; ++i)
+            {
+                updateAll(data, aircrafts, cycle++);
+                data.processAircrafts(REFERENCE, 1013.25);
+            }
+        });
+    }
+
+    const std::size_t producers = 4;
+
+    for (std::size_t shards : {std::size_t(1), producers, producers * 4})
+    {
+        runner.runOnce("aircraftdata/update " + std::to_string(producers) + " producers " +
+                           std::to_string(shards) + " shards",
+                       producers * UPDATES, [&] {
+                           AircraftData data(0, shards);
+                           contend(data, producers, false);
+                       });
+    }
+    runner.runOnce("aircraftdata/enqueue " + std::to_string(producers) + " producers",
+                   producers * UPDATES, [&] {
+                       AircraftData data;
+                       contend(data, producers, true);
+                   });
+}
@@ -0,0 +1,272 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include <cstdio>
+#include <ctime>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "data/processor/AircraftProcessor.h"
+#include "data/processor/GpsProcessor.h"
+#include "data/processor/NmeaWriter.h"
+#include "object/Aircraft.h"
+#include "object/AircraftRecord.h"
+#include "object/GpsPosition.h"
+#include "util/math.hpp"
+
+#include "Benchmark.hpp"
+
+using namespace data::processor;
+using namespace object;
+
+namespace
+{
+/**
+ * @brief The former way of appending a sentence: snprintf, checksum over the buffer, snprintf.
+ * @param buffer The format buffer
+ * @param dest   The target string
+ */
+void legacyFinish(char (&buffer)[4096], std::string& dest)
+{
+    dest.append(buffer);
+    std::snprintf(buffer, sizeof(buffer), "%02x\r\n", math::checksum(buffer, sizeof(buffer)));
+    dest.append(buffer);
+}
+
+/**
+ * @brief Records of a fleet and their reports, as the store hands them to the processor.
+ */
+struct Batch
+{
+    explicit Batch(const std::vector<Aircraft>& fleet)
+        : records(fleet.cbegin(), fleet.cend()), reports(fleet.size())
+    {
+        for (std::size_t i = 0; i < records.size(); ++i)
+        {
+            due.push_back(&records[i]);
+            dueReports.push_back(&reports[i]);
+        }
+    }
+
+    std::vector<AircraftRecord>        records;
+    std::vector<std::string>           reports;
+    std::vector<const AircraftRecord*> due;
+    std::vector<std::string*>          dueReports;
+};
+}  // namespace
+
+void bench_nmea(bench::Runner& runner)
+{
+    static char buffer[4096];
+    std::string dest;
+    dest.reserve(512);
+    std::tm utc = {};
+    utc.tm_hour = 12;
+    utc.tm_min  = 5;
+    utc.tm_sec  = 1;
+    utc.tm_mday = 17;
+    utc.tm_mon  = 9;
+    utc.tm_year = 126;
+
+    runner
+        .run("nmea/legacy PFLAU+PFLAA", 1000000,
+             [&](std::size_t i) {
+                 dest.clear();
+                 std::snprintf(buffer, sizeof(buffer), "$PFLAU,,,,1,0,%d,0,%d,%d,%s*",
+                               static_cast<int>(i % 360), -120, 15342, "AAAAAA");
+                 legacyFinish(buffer, dest);
+                 std::snprintf(buffer, sizeof(buffer),
+                               "$PFLAA,0,%d,%d,%d,%hhu,%s,%03d,,%d,%3.1lf,%1hhX*", 10500, -3200,
+                               -120, static_cast<unsigned char>(2), "AAAAAA",
+                               static_cast<int>(i % 360), 95, -1.3,
+                               static_cast<unsigned char>(1));
+                 legacyFinish(buffer, dest);
+                 bench::doNotOptimize(dest);
+             })
+        .run("nmea/writer PFLAU+PFLAA", 1000000,
+             [&](std::size_t i) {
+                 dest.clear();
+                 NmeaWriter writer(dest);
+                 writer.begin("PFLAU,,,,1,0,")
+                     .appendInt(static_cast<std::int32_t>(i % 360))
+                     .append(",0,")
+                     .appendInt(-120)
+                     .field()
+                     .appendInt(15342)
+                     .field()
+                     .append("AAAAAA")
+                     .finish();
+                 writer.begin("PFLAA,0,")
+                     .appendInt(10500)
+                     .field()
+                     .appendInt(-3200)
+                     .field()
+                     .appendInt(-120)
+                     .field()
+                     .appendInt(2)
+                     .append(",AAAAAA,")
+                     .appendInt(static_cast<std::int32_t>(i % 360), 3)
+                     .append(",,")
+                     .appendInt(95)
+                     .field()
+                     .appendFixed(-1.3, 1)
+                     .field()
+                     .appendHex(1)
+                     .finish();
+                 bench::doNotOptimize(dest);
+             })
+        .run("nmea/legacy GPGGA+GPRMC", 1000000,
+             [&](std::size_t) {
+                 dest.clear();
+                 std::snprintf(buffer, sizeof(buffer),
+                               "$GPGGA,%02d%02d%02d,%02.0lf%07.4lf,%c,%03.0lf%07.4lf,%c,1,%02hhu,1,"
+                               "%d,M,%.1lf,M,,*",
+                               utc.tm_hour, utc.tm_min, utc.tm_sec, 49.0, 30.1234, 'N', 8.0,
+                               15.4321, 'E', static_cast<unsigned char>(5), 112, 48.0);
+                 legacyFinish(buffer, dest);
+                 std::snprintf(
+                     buffer, sizeof(buffer),
+                     "$GPRMC,%02d%02d%02d,A,%02.0lf%05.2lf,%c,%03.0lf%05.2lf,%c,0,0,%02d%02d%02d,"
+                     "001.0,W*",
+                     utc.tm_hour, utc.tm_min, utc.tm_sec, 49.0, 30.1234, 'N', 8.0, 15.4321, 'E',
+                     utc.tm_mday, utc.tm_mon + 1, utc.tm_year - 100);
+                 legacyFinish(buffer, dest);
+                 bench::doNotOptimize(dest);
+             })
+        .run("nmea/writer GPGGA+GPRMC", 1000000, [&](std::size_t) {
+            dest.clear();
+            NmeaWriter writer(dest);
+            writer.begin("GPGGA,")
+                .appendInt(utc.tm_hour, 2)
+                .appendInt(utc.tm_min, 2)
+                .appendInt(utc.tm_sec, 2)
+                .field()
+                .appendFixed(49.0, 0, 2)
+                .appendFixed(30.1234, 4, 7)
+                .append(",N,")
+                .appendFixed(8.0, 0, 3)
+                .appendFixed(15.4321, 4, 7)
+                .append(",E,1,")
+                .appendInt(5, 2)
+                .append(",1,")
+                .appendInt(112)
+                .append(",M,")
+                .appendFixed(48.0, 1)
+                .append(",M,,")
+                .finish();
+            writer.begin("GPRMC,")
+                .appendInt(utc.tm_hour, 2)
+                .appendInt(utc.tm_min, 2)
+                .appendInt(utc.tm_sec, 2)
+                .append(",A,")
+                .appendFixed(49.0, 0, 2)
+                .appendFixed(30.1234, 2, 5)
+                .append(",N,")
+                .appendFixed(8.0, 0, 3)
+                .appendFixed(15.4321, 2, 5)
+                .append(",E,0,0,")
+                .appendInt(utc.tm_mday, 2)
+                .appendInt(utc.tm_mon + 1, 2)
+                .appendInt(utc.tm_year - 100, 2)
+                .append(",001.0,W")
+                .finish();
+            bench::doNotOptimize(dest);
+        });
+
+    Aircraft aircraft;
+    aircraft.set_id(0xAAAAAA);
+    aircraft.set_fullInfo(true);
+    aircraft.set_targetType(Aircraft::TargetType::FLARM);
+    aircraft.set_position({49.1, 8.1, 1000});
+    aircraft.set_movement({95.0, 180.0, -1.3});
+    AircraftProcessor aircraftProcessor;
+    aircraftProcessor.referTo({49.0, 8.0, 0}, 1013.25);
+    AircraftProcessor localProcessor(std::numeric_limits<std::int32_t>::max(), 50000);
+    localProcessor.referTo({49.0, 8.0, 0}, 1013.25);
+    GpsPosition  position({49.5, 8.25, 112}, 48.0);
+    GpsProcessor gpsProcessor;
+
+    // a large OGN range, to compare processing one by one with batches
+    std::vector<Aircraft> fleet(1000, aircraft);
+    for (std::size_t i = 0; i < fleet.size(); ++i)
+    {
+        fleet[i].set_position({47.0 + (i % 40) * 0.1, 6.0 + (i / 40) * 0.16, 1000});
+    }
+    Batch due(fleet);
+    // all within the local radius
+    std::vector<Aircraft> nearFleet(1000, aircraft);
+    for (std::size_t i = 0; i < nearFleet.size(); ++i)
+    {
+        nearFleet[i].set_position({48.6 + (i % 40) * 0.02, 7.6 + (i / 40) * 0.03, 1000});
+    }
+    Batch nearDue(nearFleet);
+
+    runner
+        .run("nmea/AircraftProcessor::process", 1000000,
+             [&](std::size_t) {
+                 aircraftProcessor.process(aircraft);
+                 bench::doNotOptimize(aircraft.get_serialized());
+             })
+        .run("nmea/AircraftProcessor::process 1000 single", 1000,
+             [&](std::size_t) {
+                 for (auto& it : fleet)
+                 {
+                     aircraftProcessor.process(it);
+                 }
+                 bench::doNotOptimize(fleet.back().get_serialized());
+             })
+        .run("nmea/AircraftProcessor::process 1000 batch", 1000,
+             [&](std::size_t) {
+                 aircraftProcessor.process(due.due, due.dueReports);
+                 bench::doNotOptimize(due.reports.back());
+             })
+        .run("nmea/AircraftProcessor::process near single", 1000,
+             [&](std::size_t) {
+                 for (auto& it : nearFleet)
+                 {
+                     aircraftProcessor.process(it);
+                 }
+                 bench::doNotOptimize(nearFleet.back().get_serialized());
+             })
+        .run("nmea/AircraftProcessor::process near batch", 1000,
+             [&](std::size_t) {
+                 aircraftProcessor.process(nearDue.due, nearDue.dueReports);
+                 bench::doNotOptimize(nearDue.reports.back());
+             })
+        .run("nmea/AircraftProcessor::process near local", 1000,
+             [&](std::size_t) {
+                 for (auto& it : nearFleet)
+                 {
+                     localProcessor.process(it);
+                 }
+                 bench::doNotOptimize(nearFleet.back().get_serialized());
+             })
+        .run("nmea/AircraftProcessor::process near local batch", 1000,
+             [&](std::size_t) {
+                 localProcessor.process(nearDue.due, nearDue.dueReports);
+                 bench::doNotOptimize(nearDue.reports.back());
+             })
+        .run("nmea/GpsProcessor::process", 1000000, [&](std::size_t) {
+            gpsProcessor.process(position);
+            bench::doNotOptimize(position.get_serialized());
+        });
+}
@@ -0,0 +1,156 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "feed/parser/AprsParser.h"
+#include "feed/parser/AtmosphereParser.h"
+#include "feed/parser/Classifier.h"
+#include "feed/parser/GpsParser.h"
+#include "feed/parser/SbsParser.h"
+#include "feed/parser/WindParser.h"
+#include "object/Aircraft.h"
+#include "object/Atmosphere.h"
+#include "object/GpsPosition.h"
+#include "object/Wind.h"
+
+#include "Benchmark.hpp"
+
+using namespace feed::parser;
+using namespace object;
+
+namespace
+{
+/// Iterations per parser
+constexpr std::size_t ITERATIONS = 500000;
+
+/// An APRS-IS stream as sent by OGN, including beacons and server comments
+const std::vector<std::string> APRS_CORPUS = {
+    "FLRAAAAAA>APRS,qAS,XXXX:/100715h4900.00N/00800.00E'/A=000000 !W19! id06AAAAAA",
+    "ICAAAAAAA>APRS,qAR:/081733h4900.00N/00800.00EX180/003/A=000000 !W38! id0DAAAAAA -138fpm "
+    "+0.0rot 6.2dB 0e +4.2kHz gps4x4",
+    "FLRBBBBBB>APRS,qAS,XXXX:/100715h4930.00S\\00815.00E^276/014/A=001000 !W07! id22BBBBBB "
+    "-019fpm +3.7rot 37.8dB 0e -51.2kHz gps2x4",
+    "FLRCCCCCC>APRS,qAS,XXXX:/074548h4900.00N/00800.00W'000/000/A=000000 id0ACCCCCC +000fpm "
+    "+0.0rot 5.5dB 3e -4.3kHz",
+    "Valhalla>APRS,TCPIP*,qAC,GLIDERN2:/074555h4900.00NI00800.00E&/A=000000 CPU:4.0 "
+    "RAM:242.7/458.8MB NTP:0.8ms/-28.6ppm +56.2C RF:+38+2.4ppm/+1.7dB",
+    "FLRDDDDDD>APRS,qAS,XXXX:/201131h4900.00N/00800.00E'180/090/A=002000 id0ADDDDDD +010fpm "
+    "+0.3rot",
+    "# aprsc 2.0.14-g28c5a6a 29 Jun 2014 07:46:15 GMT SERVER1 00.000.00.000:14580"};
+
+/// Lines of an APRS-IS stream, that are no aircraft reports
+const std::vector<std::string> APRS_BEACON_CORPUS = {
+    "Valhalla>APRS,TCPIP*,qAC,GLIDERN2:/074555h4900.00NI00800.00E&/A=000000 CPU:4.0 "
+    "RAM:242.7/458.8MB NTP:0.8ms/-28.6ppm +56.2C RF:+38+2.4ppm/+1.7dB",
+    "Valhalla>APRS,TCPIP*,qAC,GLIDERN2:>074555h v0.2.7.RPI-GPU CPU:0.7 RAM:770.2/968.2MB "
+    "NTP:1.8ms/-3.3ppm +55.7C 7/8Acfts[1h] RF:+54-1.1ppm/-0.16dB/+7.1dB@10km[19481]",
+    "# aprsc 2.0.14-g28c5a6a 29 Jun 2014 07:46:15 GMT SERVER1 00.000.00.000:14580"};
+
+/// A dump1090 SBS stream, where only MSG,3 carries positions
+const std::vector<std::string> SBS_CORPUS = {
+    "MSG,3,0,0,AAAAAA,0,2017/02/16,20:11:30.772,2017/02/16,20:11:30.772,,1000,,,49.000000,"
+    "8.000000,,,,,,0",
+    "MSG,4,0,0,AAAAAA,0,2017/02/16,20:11:30.772,2017/02/16,20:11:30.772,,,95,180,,,-64,,,,,0",
+    "MSG,3,0,0,BBBBBB,0,2017/02/16,20:11:30.772,2017/02/16,20:11:30.772,,3281,,,49.123456,"
+    "8.654321,,,,,,0",
+    "MSG,1,0,0,BBBBBB,0,2017/02/16,20:11:30.772,2017/02/16,20:11:30.772,DLH4AB,,,,,,,,,,,0",
+    "MSG,3,0,0,CCCCCC,0,2017/02/16,20:11:31.772,2017/02/16,20:11:31.772,,6562,,,48.500000,"
+    "7.250000,,,,,,0"};
+
+/// A gpsd NMEA stream
+const std::vector<std::string> GPS_CORPUS = {
+    "$GPGGA,183552,5000.0466,N,00815.7555,E,1,05,1,105,M,48.0,M,,*49\r\n",
+    "$GPRMC,183552,A,5000.0466,N,00815.7555,E,0,0,171026,001.0,W*6A\r\n"};
+
+/// A weather station NMEA stream
+const std::vector<std::string> SENSOR_CORPUS = {
+    "$WIMDA,29.7987,I,1.0091,B,14.8,C,,,,,,,,,,,,,,*3E\r\n", "$WIMWV,242.8,R,6.9,N,A*20\r\n",
+    "$YXXDR,C,19.3,C,BRDT,U,11.99,V,BRDV*75\r\n"};
+
+/**
+ * @brief Unpack a corpus round-robin.
+ * @tparam ParserT The parser type
+ * @tparam ObjectT The target type
+ * @param runner The runner
+ * @param name   The benchmark name
+ * @param corpus The sentences
+ */
+template<typename ParserT, typename ObjectT>
+void unpackCorpus(bench::Runner& runner, const std::string& name,
+                  const std::vector<std::string>& corpus)
+{
+    ParserT parser;
+    ObjectT object;
+    runner.run(name, ITERATIONS, [&](std::size_t i) {
+        bench::doNotOptimize(parser.unpack(corpus[i % corpus.size()], object));
+    });
+}
+
+/**
+ * @brief Unpack a corpus round-robin, only lines of interest as classified by a feed.
+ * @tparam ParserT   The parser type
+ * @tparam ObjectT   The target type
+ * @tparam ClassifyT The classifier type
+ * @param runner   The runner
+ * @param name     The benchmark name
+ * @param corpus   The sentences
+ * @param classify The classifier
+ */
+template<typename ParserT, typename ObjectT, typename ClassifyT>
+void classifyCorpus(bench::Runner& runner, const std::string& name,
+                    const std::vector<std::string>& corpus, ClassifyT&& classify)
+{
+    ParserT parser;
+    ObjectT object;
+    runner.run(name, ITERATIONS, [&](std::size_t i) {
+        const std::string& line = corpus[i % corpus.size()];
+        bench::doNotOptimize(classify(util::StringView(line)) && parser.unpack(line, object));
+    });
+}
+}  // namespace
+
+void bench_parsers(bench::Runner& runner)
+{
+    unpackCorpus<AprsParser, Aircraft>(runner, "parser/AprsParser::unpack", APRS_CORPUS);
+    unpackCorpus<SbsParser, Aircraft>(runner, "parser/SbsParser::unpack", SBS_CORPUS);
+    unpackCorpus<GpsParser, GpsPosition>(runner, "parser/GpsParser::unpack", GPS_CORPUS);
+    unpackCorpus<WindParser, Wind>(runner, "parser/WindParser::unpack", SENSOR_CORPUS);
+    unpackCorpus<AtmosphereParser, Atmosphere>(runner, "parser/AtmosphereParser::unpack",
+                                               SENSOR_CORPUS);
+    runner.run("parser/classifyAprs", ITERATIONS, [&](std::size_t i) {
+        bench::doNotOptimize(classifyAprs(util::StringView(APRS_CORPUS[i % APRS_CORPUS.size()])));
+    });
+    auto aircraft = [](util::StringView line) {
+        return classifyAprs(line) == LineType::AIRCRAFT;
+    };
+    classifyCorpus<AprsParser, Aircraft>(runner, "parser/classified AprsParser::unpack",
+                                         APRS_CORPUS, aircraft);
+    unpackCorpus<AprsParser, Aircraft>(runner, "parser/AprsParser::unpack beacons",
+                                       APRS_BEACON_CORPUS);
+    classifyCorpus<AprsParser, Aircraft>(runner, "parser/classified AprsParser::unpack beacons",
+                                         APRS_BEACON_CORPUS, aircraft);
+    classifyCorpus<WindParser, Wind>(runner, "parser/classified WindParser::unpack",
+                                     SENSOR_CORPUS,
+                                     [](util::StringView line) { return isNmea(line, "MWV"); });
+}
@@ -0,0 +1,190 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+#include "server/Message.h"
+#include "server/Server.hpp"
+#include "server/net/impl/SocketImplBoost.h"
+
+#include "Benchmark.hpp"
+
+using namespace server;
+
+namespace
+{
+/// Local port of the benchmark server
+constexpr std::uint16_t PORT = 47353;
+
+/// Messages per client count
+constexpr std::size_t MESSAGES = 2000;
+
+/// Aircrafts in a report
+constexpr std::size_t AIRCRAFTS = 100;
+
+/**
+ * @brief A client that drains its socket and counts the received bytes.
+ */
+class Reader
+{
+public:
+    NOT_COPYABLE(Reader)
+
+    /**
+     * @brief Constructor
+     * @param address The local address to connect from, as the server accepts one per ip
+     */
+    explicit Reader(const std::string& address) : m_socket(m_ioService)
+    {
+        m_socket.open(boost::asio::ip::tcp::v4());
+        m_socket.bind({boost::asio::ip::address::from_string(address), 0});
+        m_socket.connect({boost::asio::ip::address::from_string("127.0.0.1"), PORT});
+        m_thread = std::thread([this] {
+            char                      buffer[65536];
+            boost::system::error_code error;
+            while (!error)
+            {
+                m_received += m_socket.read_some(boost::asio::buffer(buffer), error);
+            }
+        });
+    }
+
+    ~Reader() noexcept
+    {
+        boost::system::error_code error;
+        m_socket.shutdown(boost::asio::ip::tcp::socket::shutdown_both, error);
+        m_thread.join();
+        m_socket.close(error);
+    }
+
+    /**
+     * @brief Start counting from the bytes received so far.
+     */
+    void mark()
+    {
+        m_mark = m_received;
+    }
+
+    /**
+     * @brief Get the amount of bytes received since the mark.
+     * @return the amount
+     */
+    std::uint64_t received() const
+    {
+        return m_received - m_mark;
+    }
+
+private:
+    boost::asio::io_service      m_ioService;
+    boost::asio::ip::tcp::socket m_socket;
+    std::atomic<std::uint64_t>   m_received{0};
+    std::uint64_t                m_mark = 0;
+    std::thread                  m_thread;
+};
+
+/**
+ * @brief Check whether all readers received at least an amount of bytes.
+ * @param readers The readers
+ * @param bytes   The amount of bytes
+ * @return true if so, else false
+ */
+bool receivedAll(const std::vector<std::unique_ptr<Reader>>& readers, std::uint64_t bytes)
+{
+    for (const auto& it : readers)
+    {
+        if (it->received() < bytes)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Build a report as the serve cycle does.
+ * @return the report
+ */
+std::string report()
+{
+    std::string content;
+    for (std::size_t i = 0; i < AIRCRAFTS; ++i)
+    {
+        content += "$PFLAU,,,,1,0,180,0,-120,15342,AAAAAA*33\r\n"
+                   "$PFLAA,0,10500,-3200,-120,2,AAAAAA,180,,95,-1.3,1*5B\r\n";
+    }
+    return content + "$GPRMC,120501,A,4900.00,N,00800.00,E,0,0,171026,001.0,W*6A\r\n"
+                     "$GPGGA,120501,4900.0000,N,00800.0000,E,1,05,1,112,M,48.0,M,,*4C\r\n";
+}
+}  // namespace
+
+void bench_server(bench::Runner& runner)
+{
+    const std::string templ(report());
+    auto              pool = MessagePool::create();
+
+    for (std::size_t clients = 1; clients <= S_MAX_CLIENTS; ++clients)
+    {
+        Server<net::SocketImplBoost>         server(PORT);
+        std::vector<std::unique_ptr<Reader>> readers;
+        std::string                          content;
+        server.run();
+        for (std::size_t i = 0; i < clients; ++i)
+        {
+            readers.emplace_back(new Reader("127.0.0." + std::to_string(i + 1)));
+        }
+        // probe until every connection has been accepted, then let it drain
+        while (!receivedAll(readers, 1))
+        {
+            content = "\r\n";
+            server.send(pool->seal(content));
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        for (auto& it : readers)
+        {
+            it->mark();
+        }
+        std::uint64_t expected = 0;
+
+        runner.runOnce("server/send " + std::to_string(clients) + " clients", MESSAGES, [&] {
+            for (std::size_t i = 0; i < MESSAGES; ++i)
+            {
+                content = templ;
+                server.send(pool->seal(content));
+                expected += templ.size();
+                while (!receivedAll(readers, expected))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        server.stop();
+    }
+}
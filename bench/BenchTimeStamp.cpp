@@ -0,0 +1,98 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include "object/TimeStamp.hpp"
+#include "object/impl/DateTimeImplBoost.h"
+
+#include "Benchmark.hpp"
+
+using namespace object;
+
+namespace
+{
+/**
+ * @brief The former TimeStamp construction, reading the clock twice and parsing with stoi.
+ * @param value  The time string
+ * @param format The format
+ * @return the day in upper, and milliseconds in lower 32 bits
+ */
+std::int64_t legacyTimeStamp(const std::string& value, timestamp::Format format)
+{
+    std::int32_t  h, m, s, f;
+    std::uint32_t day = static_cast<std::uint32_t>(
+        boost::posix_time::microsec_clock::universal_time().date().modjulian_day());
+    try
+    {
+        h = std::stoi(value.substr(0, 2));
+        m = std::stoi(value.substr(format == timestamp::Format::HHMMSS ? 2 : 3, 2));
+        s = std::stoi(value.substr(format == timestamp::Format::HHMMSS ? 4 : 6, 2));
+        f = format == timestamp::Format::HHMMSS ? 0 : std::stoi(value.substr(9, 3));
+    }
+    catch (const std::out_of_range&)
+    {
+        throw std::invalid_argument("");
+    }
+    std::int64_t time = h * 3600000 + m * 60000 + s * 1000 + f;
+    if (time >= boost::posix_time::time_duration(
+                    boost::posix_time::microsec_clock::universal_time().time_of_day())
+                    .total_milliseconds())
+    {
+        --day;
+    }
+    return (static_cast<std::int64_t>(day) << 32) | time;
+}
+}  // namespace
+
+void bench_timestamp(bench::Runner& runner)
+{
+    const std::string hhmmss("120501");
+    const std::string hhmmssfff("12:05:01.123");
+    TimeStamp<timestamp::DateTimeImplBoost> ts;
+
+    runner
+        .run("timestamp/legacy HHMMSS", 1000000,
+             [&](std::size_t) {
+                 bench::doNotOptimize(legacyTimeStamp(hhmmss, timestamp::Format::HHMMSS));
+             })
+        .run("timestamp/legacy HH:MM:SS.FFF", 1000000,
+             [&](std::size_t) {
+                 bench::doNotOptimize(
+                     legacyTimeStamp(hhmmssfff, timestamp::Format::HH_MM_SS_FFF));
+             })
+        .run("timestamp/tryParse HHMMSS", 10000000,
+             [&](std::size_t) {
+                 bench::doNotOptimize(TimeStamp<timestamp::DateTimeImplBoost>::tryParse(
+                     hhmmss, timestamp::Format::HHMMSS, ts));
+             })
+        .run("timestamp/tryParse HH:MM:SS.FFF", 10000000,
+             [&](std::size_t) {
+                 bench::doNotOptimize(TimeStamp<timestamp::DateTimeImplBoost>::tryParse(
+                     hhmmssfff, timestamp::Format::HH_MM_SS_FFF, ts));
+             })
+        .run("timestamp/refresh clock", 1000000,
+             [](std::size_t) { timestamp::DateTimeImplBoost::refresh(); });
+}
@@ -0,0 +1,59 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include <string>
+
+#include "util/Logger.hpp"
+
+#include "Benchmark.hpp"
+
+BENCH_FUNCTION(bench_timestamp)
+BENCH_FUNCTION(bench_nmea)
+BENCH_FUNCTION(bench_aircraft_data)
+BENCH_FUNCTION(bench_parsers)
+BENCH_FUNCTION(bench_server)
+
+int main(int argc, char** argv)
+{
+    logger.set_logFile("/dev/null");
+    std::string   filter;
+    bench::Format format = bench::Format::TABLE;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::string(argv[i]) == "--csv")
+        {
+            format = bench::Format::CSV;
+        }
+        else
+        {
+            filter = argv[i];
+        }
+    }
+    bench::Runner runner(filter, format);
+
+    bench_timestamp(runner);
+    bench_nmea(runner);
+    bench_parsers(runner);
+    bench_aircraft_data(runner);
+    bench_server(runner);
+
+    return 0;
+}
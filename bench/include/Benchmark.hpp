@@ -0,0 +1,177 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "util/defines.h"
+
+/// @def BENCH_FUNCTION
+/// Declare a function registering benchmarks.
+#define BENCH_FUNCTION(NAME) extern void NAME(bench::Runner&);
+
+namespace bench
+{
+/**
+ * @brief Get the amount of heap allocations done so far by all threads.
+ * @return the amount
+ */
+std::uint64_t allocations();
+
+/**
+ * @brief Output format of the results.
+ */
+enum class Format : std::uint8_t
+{
+    TABLE,
+    CSV
+};
+
+/**
+ * @brief Prevent the compiler from optimizing a value away.
+ * @param value The value
+ */
+template<typename T>
+inline void doNotOptimize(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Run microbenchmarks and report time and heap allocations per operation.
+ */
+class Runner
+{
+public:
+    /**
+     * @brief Constructor
+     * @param filter Only run benchmarks whose name contains this
+     * @param format The output format
+     */
+    explicit Runner(const std::string& filter = "", Format format = Format::TABLE)
+        : m_filter(filter), m_format(format)
+    {}
+
+    DEFAULT_DTOR(Runner)
+
+    /**
+     * @brief Run a benchmark, after a warmup of a tenth of the iterations.
+     * @tparam FnT The function type
+     * @param name       The benchmark name
+     * @param iterations The amount of operations
+     * @param fn         The operation, called with the iteration number
+     * @return this
+     */
+    template<typename FnT>
+    Runner& run(const std::string& name, std::size_t iterations, FnT&& fn)
+    {
+        if (name.find(m_filter) == std::string::npos)
+        {
+            return *this;
+        }
+        for (std::size_t i = 0; i < iterations / 10; ++i)
+        {
+            fn(i);
+        }
+        std::uint64_t allocs = allocations();
+        auto          start  = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            fn(i);
+        }
+        report(name, iterations,
+               std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start)
+                   .count(),
+               allocations() - allocs);
+        return *this;
+    }
+
+    /**
+     * @brief Run a function once, which performs a given amount of operations itself.
+     * @tparam FnT The function type
+     * @param name       The benchmark name
+     * @param operations The amount of operations done by the function
+     * @param fn         The function
+     * @return this
+     */
+    template<typename FnT>
+    Runner& runOnce(const std::string& name, std::size_t operations, FnT&& fn)
+    {
+        if (name.find(m_filter) == std::string::npos)
+        {
+            return *this;
+        }
+        std::uint64_t allocs = allocations();
+        auto          start  = std::chrono::steady_clock::now();
+        fn();
+        report(name, operations,
+               std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start)
+                   .count(),
+               allocations() - allocs);
+        return *this;
+    }
+
+private:
+    /**
+     * @brief Print the result of a benchmark.
+     * @param name       The benchmark name
+     * @param operations The amount of operations
+     * @param ns         The elapsed time; ns
+     * @param allocs     The amount of heap allocations
+     */
+    void report(const std::string& name, std::size_t operations, double ns, std::uint64_t allocs)
+    {
+        double nsPerOp     = ns / operations;
+        double allocsPerOp = static_cast<double>(allocs) / operations;
+        double opsPerSec   = operations * 1e9 / ns;
+        if (m_format == Format::CSV)
+        {
+            if (!m_headerDone)
+            {
+                std::printf("name,operations,ns_per_op,allocs_per_op,ops_per_s\n");
+                m_headerDone = true;
+            }
+            std::printf("\"%s\",%zu,%.1f,%.3f,%.0f\n", name.c_str(), operations, nsPerOp,
+                        allocsPerOp, opsPerSec);
+        }
+        else
+        {
+            std::printf("%-48s %12.1f ns/op %9.2f allocs/op %14.0f op/s\n", name.c_str(),
+                        nsPerOp, allocsPerOp, opsPerSec);
+        }
+        std::fflush(stdout);
+    }
+
+    /// The name filter
+    const std::string m_filter;
+
+    /// The output format
+    const Format m_format;
+
+    /// Whether the CSV header has been printed
+    bool m_headerDone = false;
+};
+}  // namespace bench
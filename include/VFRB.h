@@ -23,15 +23,22 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <string>
 
+#include "server/Message.h"
 #include "server/Server.hpp"
 #include "server/net/impl/NetworkInterfaceImplBoost.h"
 #include "server/net/impl/SocketImplBoost.h"
+#include "util/Scheduler.h"
 #include "util/defines.h"
 
+namespace client
+{
+class Replay;
+}  // namespace client
 namespace config
 {
 class Configuration;
@@ -76,10 +83,22 @@ private:
     void createFeeds(std::shared_ptr<config::Configuration> config);
 
     /**
-     * @brief Serve the data frequently every second.
+     * @brief Serve the data at the configured rates, aligned to wall-clock boundaries.
+     *
+     * Aircrafts are aged once per second, and processed whenever they are served.
+     * Data with a rate of 0 is served as soon as it changed, aircrafts also if emit on update
+     * is enabled.
+     * @note When replaying, all rates are accelerated alike, and serving ends with the replay.
      */
     void serve();
 
+    /**
+     * @brief Get the period of a rate.
+     * @param rate The rate; Hz, 0 if none
+     * @return the period, accelerated like the replay if any; zero if none
+     */
+    util::Scheduler::Clock::duration periodOf(double rate) const;
+
     /**
      * @brief Get the duration from given start value as formatted string.
      * @param start The start value
@@ -99,9 +118,36 @@ private:
     /// Wind data container
     std::shared_ptr<data::WindData> m_windData;
 
+    /// Buffers for the reports of each cycle
+    std::shared_ptr<server::MessagePool> m_messagePool;
+
     /// Manage clients and sending of data
     server::Server<server::net::SocketImplBoost> m_server;
 
+    /// Recordings to replay instead of connecting, if any
+    std::shared_ptr<client::Replay> m_replay;
+
+    /// Local port where to serve metrics, 0 if disabled
+    const std::uint16_t m_statsPort;
+
+    /// Output rate of aircrafts; Hz
+    const double m_aircraftRate;
+
+    /// Output rate of the GPS position; Hz, 0 if on change
+    const double m_gpsRate;
+
+    /// Output rate of atmospheric data; Hz, 0 if on change
+    const double m_atmosphereRate;
+
+    /// Output rate of wind data; Hz, 0 if on change
+    const double m_windRate;
+
+    /// Emit aircrafts as soon as updated?
+    const bool m_emitOnUpdate;
+
+    /// Schedule of the output, woken by updates to serve on change
+    util::Scheduler m_scheduler;
+
     /// List of all active feeds
     std::list<std::shared_ptr<feed::Feed>> m_feeds;
 
@@ -21,7 +21,10 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <string>
+#include <vector>
 
 #include "Client.h"
 #include "parameters.h"
@@ -32,6 +35,12 @@
 #    define AC_BEACON_INT 600
 #endif
 
+#ifdef APRSCCLIENT_FILTER_INTERVAL
+#    define AC_FILTER_INT APRSCCLIENT_FILTER_INTERVAL
+#else
+#    define AC_FILTER_INT 60
+#endif
+
 namespace client
 {
 /**
@@ -43,6 +52,10 @@ public:
     NOT_COPYABLE(AprscClient)
     DEFAULT_DTOR(AprscClient)
 
+    /// @typedef Filter
+    /// Provider of the current filter command
+    using Filter = std::function<std::string()>;
+
     /**
      * @brief Constructor
      * @param endpoint  The remote endpoint
@@ -56,12 +69,47 @@ public:
 
     std::size_t hash() const override;
 
+    /**
+     * @brief Extend Client::subscribe by the filter the Feed generates, if any.
+     * @param feed The AprscFeed to subscribe
+     * @threadsafe
+     */
+    void subscribe(std::shared_ptr<feed::Feed> feed) override;
+
+    /**
+     * @brief Add a filter to append to the login, and to refresh when changed.
+     * Filters of all feeds sharing this client are combined.
+     * @param filter The filter
+     * @threadsafe
+     */
+    void addFilter(Filter filter);
+
+    /**
+     * @brief Get the filter combined from all added ones.
+     * As the server ORs all terms, the connection gets what any of the feeds asked for.
+     * @return the filter command, empty if none
+     * @threadsafe
+     */
+    std::string get_filter() const;
+
 private:
     /**
-     * @brief Schedule sending of a keep-alive beacon.
+     * @brief Combine the filters.
+     * @return the filter command, empty if none
+     */
+    std::string combineFilters() const;
+
+    /**
+     * @brief Schedule sending of a keep-alive beacon, or a refreshed filter.
      */
     void sendKeepAlive();
 
+    /**
+     * @brief Get the interval of scheduled sends.
+     * @return the interval in seconds
+     */
+    std::uint32_t get_interval() const;
+
     /**
      * @brief Implement Client::handleConnect
      * @threadsafe
@@ -76,7 +124,7 @@ private:
     void handleLogin(net::ErrorCode error);
 
     /**
-     * @brief Handler for sending a keep-alive beacon.
+     * @brief Handler for sending a keep-alive beacon, or a refreshed filter.
      * @param error The error indicator
      * @threadsafe
      */
@@ -84,6 +132,18 @@ private:
 
     /// Login string
     const std::string m_login;
+
+    /// Filter providers of all subscribed feeds
+    std::vector<Filter> m_filters;
+
+    /// Filter the server currently applies
+    std::string m_sentFilter;
+
+    /// Message being written
+    std::string m_message;
+
+    /// Seconds since the last message
+    std::uint32_t m_idle = 0;
 };
 
 }  // namespace client
@@ -63,6 +63,14 @@ public:
      */
     void run();
 
+    /**
+     * @brief Schedule to connect, without running the event handlers.
+     * @note The event handlers must be run elsewhere, e.g. by a shared IO-service.
+     * @return true if started, false if already started
+     * @threadsafe
+     */
+    bool start();
+
     /**
      * @brief Stop after client has been started.
      * @note Wait until run has been called.
@@ -88,7 +96,7 @@ public:
      * @param feed The Feed to subscribe
      * @threadsafe
      */
-    void subscribe(std::shared_ptr<feed::Feed> feed);
+    virtual void subscribe(std::shared_ptr<feed::Feed> feed);
 
 protected:
     enum class State : std::uint_fast8_t
@@ -142,10 +150,10 @@ protected:
 
     /**
      * @brief Handler for read
-     * @param error    The error indicator
-     * @param response The received string
+     * @param error The error indicator
+     * @param lines The received lines
      */
-    void handleRead(net::ErrorCode error, const std::string& response);
+    void handleRead(net::ErrorCode error, const net::Lines& lines);
 
     /**
      * @brief Handler for connect
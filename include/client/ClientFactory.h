@@ -34,6 +34,13 @@ class Feed;
 
 namespace client
 {
+class Replay;
+
+namespace net
+{
+class IoServicePool;
+}  // namespace net
+
 /**
  * @brief A factory for clients.
  */
@@ -45,21 +52,31 @@ public:
 
     /**
      * @brief Create a Client needed by a Feed.
-     * @param feed The feed to create for
+     * @param feed   The feed to create for
+     * @param pool   The pool to share the IO-service of, or nullptr to use an own (default)
+     * @param replay The replay to read the feeds recording from, or nullptr to connect (default)
      * @return the client as pointer
+     * @throw std::logic_error if the feed has no recording to replay
      */
-    static std::shared_ptr<Client> createClientFor(std::shared_ptr<feed::Feed> feed);
+    static std::shared_ptr<Client>
+        createClientFor(std::shared_ptr<feed::Feed>         feed,
+                        std::shared_ptr<net::IoServicePool> pool   = nullptr,
+                        std::shared_ptr<Replay>             replay = nullptr);
 
 private:
     /**
      * @brief Factory method for Client creation.
      * @tparam T The type of client
-     * @param feed The feed to create for
+     * @param feed      The feed to create for
+     * @param endpoint  The endpoint to connect to
+     * @param connector The connector to use
      * @return the client as pointer
      */
     template<typename T,
              typename std::enable_if<std::is_base_of<Client, T>::value>::type* = nullptr>
-    static std::shared_ptr<T> makeClient(std::shared_ptr<feed::Feed> feed);
+    static std::shared_ptr<T> makeClient(std::shared_ptr<feed::Feed>     feed,
+                                         const net::Endpoint&            endpoint,
+                                         std::shared_ptr<net::Connector> connector);
 };
 
 }  // namespace client
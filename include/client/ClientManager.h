@@ -32,6 +32,15 @@
 #include "util/defines.h"
 
 #include "Client.h"
+#include "parameters.h"
+
+/// @def C_IO_THREADS
+/// The amount of threads for all clients, 0 for one thread per client
+#ifdef CLIENT_IO_THREADS
+#    define C_IO_THREADS CLIENT_IO_THREADS
+#else
+#    define C_IO_THREADS 0
+#endif
 
 namespace feed
 {
@@ -61,6 +70,13 @@ private:
 
 namespace client
 {
+class Replay;
+
+namespace net
+{
+class IoServicePool;
+}  // namespace net
+
 /**
  * @brief Functor for hashing clients.
  */
@@ -98,7 +114,15 @@ using ClientIter = ClientSet::iterator;
 class ClientManager
 {
 public:
-    DEFAULT_CTOR(ClientManager)
+    NOT_COPYABLE(ClientManager)
+
+    /**
+     * @brief Constructor
+     * @param threads The amount of threads shared by all clients, 0 for one thread per client
+     * @param replay  The replay to read all feeds from, or nullptr to connect (default)
+     */
+    explicit ClientManager(std::size_t threads = C_IO_THREADS,
+                           std::shared_ptr<Replay> replay = nullptr);
 
     ~ClientManager() noexcept;
 
@@ -110,7 +134,7 @@ public:
     void subscribe(std::shared_ptr<feed::Feed> feed);
 
     /**
-     * @brief Run all clients in their own thread.
+     * @brief Run all clients in their own thread, or on the shared threads.
      * @threadsafe
      */
     void run();
@@ -129,6 +153,12 @@ private:
     /// Thread group for client threads
     thread_group m_thdGroup;
 
+    /// Shared IO-service, if any
+    std::shared_ptr<net::IoServicePool> m_pool;
+
+    /// Replay, if any
+    std::shared_ptr<Replay> m_replay;
+
     mutable std::mutex m_mutex;
 };
 
@@ -0,0 +1,134 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "util/defines.h"
+
+namespace client
+{
+/// @def REPLAY_PORT
+/// Port of the endpoint of a replayed feed, whose host is the recorded file
+#define REPLAY_PORT "replay"
+
+/**
+ * @brief Recorded files to replay instead of connecting to the feeds endpoints.
+ *
+ * Every connector replaying a file enrolls here, to know when all recordings have been replayed
+ * and to sum up the statistics.
+ */
+class Replay
+{
+public:
+    NOT_COPYABLE(Replay)
+    DEFAULT_DTOR(Replay)
+
+    /**
+     * @brief Constructor
+     * @param files Map feed names to their recorded files
+     * @param speed The pace; 1 for real-time, N for N times faster, 0 for as fast as possible
+     */
+    Replay(const std::unordered_map<std::string, std::string>& files, double speed);
+
+    /**
+     * @brief Get the recorded file of a feed.
+     * @param feed The feed name
+     * @return the file path
+     * @throw std::logic_error if there is no recording for the feed
+     */
+    const std::string& fileOf(const std::string& feed) const;
+
+    /**
+     * @brief Enroll a recording to be replayed.
+     * @threadsafe
+     */
+    void enroll();
+
+    /**
+     * @brief Mark the start of replaying a recording.
+     * @threadsafe
+     */
+    void begin();
+
+    /**
+     * @brief Mark the end of replaying an enrolled recording.
+     * @param lines The amount of replayed lines
+     * @threadsafe
+     */
+    void end(std::uint64_t lines);
+
+    /**
+     * @brief Check whether all enrolled recordings have been replayed.
+     * @return true if so, else false
+     * @threadsafe
+     */
+    bool done() const;
+
+    /**
+     * @brief Get the time from the first begin to the last end.
+     * @return the duration; s
+     * @threadsafe
+     */
+    double get_seconds() const;
+
+private:
+    /// Map feed names to files
+    const std::unordered_map<std::string, std::string> m_files;
+
+    /// The pace
+    double m_speed;
+
+    /// Amount of enrolled recordings not yet replayed
+    std::atomic<std::uint32_t> m_pending;
+
+    /// Amount of replayed lines
+    std::atomic<std::uint64_t> m_lines;
+
+    /// Time of the first begin
+    std::chrono::steady_clock::time_point m_begin;
+
+    /// Time of the last end
+    std::chrono::steady_clock::time_point m_end;
+
+    /// Whether any recording has begun
+    bool m_begun = false;
+
+    mutable std::mutex m_mutex;
+
+public:
+    /**
+     * Getters
+     */
+    GETTER_V(speed)
+
+    std::uint64_t get_lines() const
+    {
+        return m_lines;
+    }
+};
+}  // namespace client
@@ -24,8 +24,20 @@
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <vector>
 
 #include "util/defines.h"
+#include "util/utility.hpp"
+
+#include "parameters.h"
+
+/// @def C_READ_BUFFER_SIZE
+/// The size of the read buffer per connector, and the max size of a batch of lines
+#ifdef CLIENT_READ_BUFFER_SIZE
+#    define C_READ_BUFFER_SIZE CLIENT_READ_BUFFER_SIZE
+#else
+#    define C_READ_BUFFER_SIZE 65536
+#endif
 
 namespace client
 {
@@ -43,9 +55,13 @@ enum class ErrorCode : std::uint_fast8_t
 /// Common callback function
 using Callback = std::function<void(ErrorCode)>;
 
+/// @typedef Lines
+/// Batch of received lines, each including its delimiter
+using Lines = std::vector<util::StringView>;
+
 /// @typedef ReadCallback
 /// Callback function for read
-using ReadCallback = std::function<void(ErrorCode, const std::string&)>;
+using ReadCallback = std::function<void(ErrorCode, const Lines&)>;
 
 /**
  * @brief The async TCP interface for clients
@@ -83,6 +99,7 @@ public:
 
     /**
      * @brief Attempt to read from current connection.
+     * @note The lines passed to the callback are valid until the next read.
      * @param callback The callback to execute when done
      */
     virtual void onRead(const ReadCallback& callback) = 0;
@@ -21,7 +21,9 @@
 
 #pragma once
 
-#include <istream>
+#include <cstddef>
+#include <memory>
+#include <vector>
 
 #include <boost/asio.hpp>
 #include <boost/system/error_code.hpp>
@@ -33,8 +35,15 @@ namespace client
 {
 namespace net
 {
+class IoServicePool;
+
 /**
  * @brief Implement the Connector interface using boost::asio.
+ *
+ * All handlers are serialized by a strand, so that the IO-service may be shared with other
+ * connectors and run by multiple threads.
+ * Data is read in chunks into a reusable buffer, and all complete lines of a chunk are passed
+ * to the read callback at once, as views into that buffer.
  */
 class ConnectorImplBoost : public Connector
 {
@@ -42,16 +51,25 @@ public:
     NOT_COPYABLE(ConnectorImplBoost)
     DEFAULT_DTOR(ConnectorImplBoost)
 
+    /**
+     * @brief Constructor using an own IO-service.
+     */
     ConnectorImplBoost();
 
     /**
-     * @brief Run the internal event handler queue.
-     * @note Blocks until all handlers have returned.
+     * @brief Constructor using a shared IO-service.
+     * @param pool The pool providing the IO-service
+     */
+    explicit ConnectorImplBoost(std::shared_ptr<IoServicePool> pool);
+
+    /**
+     * @brief Run the event handler queue.
+     * @note Blocks until all handlers have returned, or the shared IO-service has stopped.
      */
     void run() override;
 
     /**
-     * @brief Stop the internal event handler queue and close the connection.
+     * @brief Close the connection and stop the event handler queue, unless it is shared.
      */
     void stop() override;
 
@@ -68,7 +86,8 @@ public:
     void onConnect(const Endpoint& endpoint, const Callback& callback) override;
 
     /**
-     * @brief Schedule to read from endpoint.
+     * @brief Schedule to read lines from endpoint.
+     * @note The callback is invoked once at least one complete line has been received.
      * @param callback The callback to invoke when done
      */
     void onRead(const ReadCallback& callback) override;
@@ -128,6 +147,12 @@ private:
      */
     void handleTimeout(const boost::system::error_code& error, const Callback& callback) noexcept;
 
+    /**
+     * @brief Schedule to read a chunk into the free part of the read buffer.
+     * @param callback The callback to invoke with complete lines
+     */
+    void readChunk(const ReadCallback& callback);
+
     /**
      * @brief Handler for reading from endpoint
      * @param error    The error code
@@ -146,8 +171,17 @@ private:
     void handleWrite(const boost::system::error_code& error, std::size_t bytes,
                      const Callback& callback) noexcept;
 
-    /// Internal IO-service
-    boost::asio::io_service m_ioService;
+    /// Pool providing the shared IO-service, if any
+    std::shared_ptr<IoServicePool> m_pool;
+
+    /// Own IO-service, if not shared
+    std::unique_ptr<boost::asio::io_service> m_ownIoService;
+
+    /// IO-service in use
+    boost::asio::io_service& m_ioService;
+
+    /// Serialize handlers
+    boost::asio::io_service::strand m_strand;
 
     /// Connection socket
     boost::asio::ip::tcp::socket m_socket;
@@ -159,13 +193,16 @@ private:
     boost::asio::deadline_timer m_timer;
 
     /// Read buffer
-    boost::asio::streambuf m_buffer;
+    std::vector<char> m_buffer;
+
+    /// Amount of bytes in the read buffer
+    std::size_t m_bufferSize = 0;
 
-    /// Read message
-    std::string m_response;
+    /// Start of the first line not yet passed to the callback
+    std::size_t m_lineStart = 0;
 
-    /// Message stream for conversion
-    std::istream m_istream;
+    /// Lines of the last chunk
+    Lines m_lines;
 };
 }  // namespace net
 }  // namespace client
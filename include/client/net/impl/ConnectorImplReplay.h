@@ -0,0 +1,194 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/system/error_code.hpp>
+
+#include "client/net/Connector.hpp"
+#include "util/defines.h"
+
+namespace client
+{
+class Replay;
+
+namespace net
+{
+/**
+ * @brief Implement the Connector interface by replaying a recorded file.
+ *
+ * The endpoints host is the path of the file, which contains the raw lines as received.
+ * A line may be prefixed by the time it was received, in seconds with optional fraction and
+ * followed by a space or tab, as written by e.g. "nc host port | ts %.s".
+ * Those times are used to pace the replay, lines without a time are passed right away.
+ * Nothing is written to the recording, writes just succeed.
+ * At the end of the file the event handler queue is stopped.
+ */
+class ConnectorImplReplay : public Connector
+{
+public:
+    NOT_COPYABLE(ConnectorImplReplay)
+
+    /**
+     * @brief Constructor
+     * @param replay The replay to enroll in
+     */
+    explicit ConnectorImplReplay(std::shared_ptr<Replay> replay);
+
+    ~ConnectorImplReplay() noexcept;
+
+    /**
+     * @brief Run the event handler queue.
+     * @note Blocks until all handlers have returned, or the recording has ended.
+     */
+    void run() override;
+
+    /**
+     * @brief Close the file and stop the event handler queue.
+     */
+    void stop() override;
+
+    /**
+     * @brief Close the file and cancel all timers.
+     */
+    void close() override;
+
+    /**
+     * @brief Schedule to open the recorded file.
+     * @param endpoint The endpoint, whose host is the file
+     * @param callback The callback to invoke when done
+     */
+    void onConnect(const Endpoint& endpoint, const Callback& callback) override;
+
+    /**
+     * @brief Schedule to read the lines, which are due.
+     * @param callback The callback to invoke when done
+     */
+    void onRead(const ReadCallback& callback) override;
+
+    /**
+     * @brief Schedule to write nothing.
+     * @param msg      The message, which is discarded
+     * @param callback The callback to invoke when done
+     */
+    void onWrite(const std::string& msg, const Callback& callback) override;
+
+    /**
+     * @brief Schedule an action after a timeout.
+     * @note A timeout of 0 only adds the action and does not modify the timer.
+     * @param callback The callback to invoke when timeout is reached
+     * @param timeout  The timeout in seconds (default: 0)
+     */
+    void onTimeout(const Callback& callback, std::uint32_t timeout = 0) override;
+
+    /**
+     * @brief Reset the timer to this value.
+     * @param timeout The new timeout
+     */
+    void resetTimer(std::uint32_t timeout) override;
+
+    /**
+     * @brief Check whether the timer is expired.
+     * @return true if expired, else false
+     */
+    bool timerExpired() override;
+
+private:
+    /**
+     * @brief Pass all due lines up to the batch size, or wait until the next line is due.
+     * @param callback The callback to invoke with the lines
+     */
+    void readBatch(const ReadCallback& callback);
+
+    /**
+     * @brief Read the next non-empty line from the file and split off its time.
+     * @return true if a line was read, false at the end of the file
+     */
+    bool nextLine();
+
+    /**
+     * @brief Get the time when the current line is due.
+     * @return the time point
+     */
+    std::chrono::steady_clock::time_point dueTime() const;
+
+    /**
+     * @brief Finish the replay, once.
+     */
+    void finish();
+
+    /// The replay
+    std::shared_ptr<Replay> m_replay;
+
+    /// IO-service
+    boost::asio::io_service m_ioService;
+
+    /// Timer
+    boost::asio::deadline_timer m_timer;
+
+    /// Timer to pace the replay
+    boost::asio::steady_timer m_pacer;
+
+    /// The recorded file
+    std::ifstream m_file;
+
+    /// Current line, without delimiter
+    std::string m_line;
+
+    /// Whether the current line is yet to be passed
+    bool m_hasLine = false;
+
+    /// Receive time of the current line; s
+    double m_lineTime = 0.0;
+
+    /// Receive time of the first timed line; s
+    double m_firstTime = -1.0;
+
+    /// When the file was opened
+    std::chrono::steady_clock::time_point m_start;
+
+    /// Lines of the current batch, each with delimiter
+    std::string m_batch;
+
+    /// Ends of the lines in the batch
+    std::vector<std::size_t> m_ends;
+
+    /// Views of the lines in the batch
+    Lines m_lines;
+
+    /// Amount of passed lines
+    std::uint64_t m_replayed = 0;
+
+    /// Whether the replay has finished
+    bool m_finished = false;
+};
+}  // namespace net
+}  // namespace client
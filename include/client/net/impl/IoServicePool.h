@@ -0,0 +1,84 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+#include "util/defines.h"
+
+namespace client
+{
+namespace net
+{
+/**
+ * @brief An IO-service shared by multiple connectors, run by a fixed amount of threads.
+ */
+class IoServicePool
+{
+public:
+    NOT_COPYABLE(IoServicePool)
+
+    /**
+     * @brief Constructor
+     * @param threads The amount of worker threads, at least 1
+     */
+    explicit IoServicePool(std::size_t threads);
+
+    ~IoServicePool() noexcept;
+
+    /**
+     * @brief Start all worker threads.
+     */
+    void run();
+
+    /**
+     * @brief Stop the IO-service.
+     * @note Blocks until all worker threads have returned.
+     */
+    void stop();
+
+    /**
+     * @brief Get the shared IO-service.
+     * @return the IO-service
+     */
+    boost::asio::io_service& get();
+
+private:
+    /// Shared IO-service
+    boost::asio::io_service m_ioService;
+
+    /// Keep the IO-service running without pending handlers
+    std::unique_ptr<boost::asio::io_service::work> m_work;
+
+    /// Worker threads
+    std::vector<std::thread> m_threads;
+
+    /// Amount of worker threads
+    const std::size_t m_size;
+};
+}  // namespace net
+}  // namespace client
@@ -38,6 +38,7 @@
 #define SECT_KEY_FALLBACK "fallback"
 #define SECT_KEY_GENERAL "general"
 #define SECT_KEY_FILTER "filter"
+#define SECT_KEY_OUTPUT "output"
 
 /**
  * Keywords for feeds
@@ -54,6 +55,8 @@
 #define KV_KEY_FEEDS "feeds"
 #define KV_KEY_GND_MODE "gndMode"
 #define KV_KEY_SERVER_PORT "serverPort"
+#define KV_KEY_STATS_PORT "statsPort"
+#define KV_KEY_LOCAL_RADIUS "localRadius"
 
 /**
  * Property keys for section "fallback"
@@ -70,6 +73,15 @@
 #define KV_KEY_MAX_DIST "maxDist"
 #define KV_KEY_MAX_HEIGHT "maxHeight"
 
+/**
+ * Property keys for section "output"
+ */
+#define KV_KEY_AIRCRAFT_RATE "aircraftRate"
+#define KV_KEY_GPS_RATE "gpsRate"
+#define KV_KEY_ATMOS_RATE "atmRate"
+#define KV_KEY_WIND_RATE "windRate"
+#define KV_KEY_EMIT_ON_UPDATE "emitOnUpdate"
+
 /**
  * Property keys for feed sections
  */
@@ -77,6 +89,9 @@
 #define KV_KEY_PORT "port"
 #define KV_KEY_PRIORITY "priority"
 #define KV_KEY_LOGIN "login"
+#define KV_KEY_REGEX_FALLBACK "regexFallback"
+#define KV_KEY_AUTO_FILTER "autoFilter"
+#define KV_KEY_FILTER_TERMS "filterTerms"
 
 /// Concat section and key
 #define PATH(S, K) (S "." K)
@@ -86,16 +101,23 @@ namespace config
 /**
  * Path definitions
  */
-constexpr const char* PATH_FEEDS       = PATH(SECT_KEY_GENERAL, KV_KEY_FEEDS);
-constexpr const char* PATH_GND_MODE    = PATH(SECT_KEY_GENERAL, KV_KEY_GND_MODE);
-constexpr const char* PATH_SERVER_PORT = PATH(SECT_KEY_GENERAL, KV_KEY_SERVER_PORT);
-constexpr const char* PATH_LATITUDE    = PATH(SECT_KEY_FALLBACK, KV_KEY_LATITUDE);
-constexpr const char* PATH_LONGITUDE   = PATH(SECT_KEY_FALLBACK, KV_KEY_LONGITUDE);
-constexpr const char* PATH_ALTITUDE    = PATH(SECT_KEY_FALLBACK, KV_KEY_ALTITUDE);
-constexpr const char* PATH_GEOID       = PATH(SECT_KEY_FALLBACK, KV_KEY_GEOID);
-constexpr const char* PATH_PRESSURE    = PATH(SECT_KEY_FALLBACK, KV_KEY_PRESSURE);
-constexpr const char* PATH_MAX_DIST    = PATH(SECT_KEY_FILTER, KV_KEY_MAX_DIST);
-constexpr const char* PATH_MAX_HEIGHT  = PATH(SECT_KEY_FILTER, KV_KEY_MAX_HEIGHT);
+constexpr const char* PATH_FEEDS          = PATH(SECT_KEY_GENERAL, KV_KEY_FEEDS);
+constexpr const char* PATH_GND_MODE       = PATH(SECT_KEY_GENERAL, KV_KEY_GND_MODE);
+constexpr const char* PATH_SERVER_PORT    = PATH(SECT_KEY_GENERAL, KV_KEY_SERVER_PORT);
+constexpr const char* PATH_STATS_PORT     = PATH(SECT_KEY_GENERAL, KV_KEY_STATS_PORT);
+constexpr const char* PATH_LOCAL_RADIUS   = PATH(SECT_KEY_GENERAL, KV_KEY_LOCAL_RADIUS);
+constexpr const char* PATH_LATITUDE       = PATH(SECT_KEY_FALLBACK, KV_KEY_LATITUDE);
+constexpr const char* PATH_LONGITUDE      = PATH(SECT_KEY_FALLBACK, KV_KEY_LONGITUDE);
+constexpr const char* PATH_ALTITUDE       = PATH(SECT_KEY_FALLBACK, KV_KEY_ALTITUDE);
+constexpr const char* PATH_GEOID          = PATH(SECT_KEY_FALLBACK, KV_KEY_GEOID);
+constexpr const char* PATH_PRESSURE       = PATH(SECT_KEY_FALLBACK, KV_KEY_PRESSURE);
+constexpr const char* PATH_MAX_DIST       = PATH(SECT_KEY_FILTER, KV_KEY_MAX_DIST);
+constexpr const char* PATH_MAX_HEIGHT     = PATH(SECT_KEY_FILTER, KV_KEY_MAX_HEIGHT);
+constexpr const char* PATH_AIRCRAFT_RATE  = PATH(SECT_KEY_OUTPUT, KV_KEY_AIRCRAFT_RATE);
+constexpr const char* PATH_GPS_RATE       = PATH(SECT_KEY_OUTPUT, KV_KEY_GPS_RATE);
+constexpr const char* PATH_ATMOS_RATE     = PATH(SECT_KEY_OUTPUT, KV_KEY_ATMOS_RATE);
+constexpr const char* PATH_WIND_RATE      = PATH(SECT_KEY_OUTPUT, KV_KEY_WIND_RATE);
+constexpr const char* PATH_EMIT_ON_UPDATE = PATH(SECT_KEY_OUTPUT, KV_KEY_EMIT_ON_UPDATE);
 
 /**
  * @brief VFRB Configuration
@@ -121,11 +143,14 @@ private:
     object::GpsPosition resolvePosition(const Properties& properties) const;
 
     /**
-     * @brief Resolve the server port.
+     * @brief Resolve a port.
      * @param properties The properties
+     * @param path       The key path
+     * @param fallback   The port if none, or an invalid one is given
      * @return the port number
      */
-    std::uint16_t resolveServerPort(const Properties& properties) const;
+    std::uint16_t resolvePort(const Properties& properties, const char* path,
+                              std::uint16_t fallback) const;
 
     /**
      * @brief Resolve the feeds and their config.
@@ -142,6 +167,24 @@ private:
      */
     std::int32_t resolveFilter(const Properties& properties, const std::string& key) const;
 
+    /**
+     * @brief Resolve the radius of local projection.
+     * @note An invalid/negative value results in 0 which means disabled.
+     * @param properties The properties
+     * @return the radius
+     */
+    std::int32_t resolveLocalRadius(const Properties& properties) const;
+
+    /**
+     * @brief Resolve an output rate.
+     * @note An invalid value, or 0 if not allowed, results in 1; rates are limited to 50.
+     * @param properties The properties
+     * @param path       The key path
+     * @param onChange   Whether 0 is allowed, which means on change
+     * @return the rate; Hz
+     */
+    double resolveRate(const Properties& properties, const char* path, bool onChange) const;
+
     /**
      * @brief Check an optional Number to be valid.
      * @param number The optinonal Number
@@ -171,6 +214,27 @@ private:
     /// Port where to serve reports
     std::uint16_t m_serverPort;
 
+    /// Local port where to serve metrics, 0 if disabled
+    std::uint16_t m_statsPort;
+
+    /// Radius around the position, where aircrafts are projected on a plane; m, 0 if disabled
+    std::int32_t m_localRadius;
+
+    /// Output rate of aircrafts; Hz
+    double m_aircraftRate;
+
+    /// Output rate of the GPS position; Hz, 0 if on change
+    double m_gpsRate;
+
+    /// Output rate of atmospheric data; Hz, 0 if on change
+    double m_atmosphereRate;
+
+    /// Output rate of wind data; Hz, 0 if on change
+    double m_windRate;
+
+    /// Emit aircrafts as soon as updated, besides the periodic output
+    bool m_emitOnUpdate;
+
     /// Ground mode state
     bool m_groundMode;
 
@@ -180,6 +244,12 @@ private:
     ///  Map feed names to their properties
     std::unordered_map<std::string, Properties> m_feedProperties;
 
+    /// Map feed names to recorded files to replay instead
+    std::unordered_map<std::string, std::string> m_replayFiles;
+
+    /// Pace of the replay; 1 for real-time, N for N times faster, 0 for as fast as possible
+    double m_replaySpeed = 1.0;
+
 public:
     /**
      * Getters
@@ -189,9 +259,18 @@ public:
     GETTER_V(maxHeight)
     GETTER_V(maxDistance)
     GETTER_V(serverPort)
+    GETTER_V(statsPort)
+    GETTER_V(localRadius)
+    GETTER_V(aircraftRate)
+    GETTER_V(gpsRate)
+    GETTER_V(atmosphereRate)
+    GETTER_V(windRate)
+    GETTER_V(emitOnUpdate)
     GETSET_V(groundMode)
     GETTER_CR(feedNames)
     GETTER_CR(feedProperties)
+    GETSET_CR(replayFiles)
+    GETSET_V(replaySpeed)
 };
 
 }  // namespace config
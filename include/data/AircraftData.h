@@ -21,16 +21,28 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <mutex>
 #include <string>
-#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "object/Aircraft.h"
+#include "object/AircraftRecord.h"
 #include "processor/AircraftProcessor.h"
+#include "util/FlatIndex.h"
+#include "util/GeoGrid.h"
+#include "util/MpscQueue.hpp"
 #include "util/defines.h"
 
+namespace util
+{
+class Gauge;
+struct FeedMetrics;
+}  // namespace util
+
 #include "Data.hpp"
 
 /// Times until aircraft gets deleted
@@ -43,6 +55,11 @@ namespace data
 {
 /**
  * @brief Store aircrafts.
+ *
+ * Aircrafts are partitioned into shards by their id, each shard guarded by its own lock.
+ * Within a shard aircrafts are held as compact records in a dense array, their reports in a
+ * parallel one; removal swaps the last entry into the gap.
+ * Feeds may enqueue updates, which are applied in a batch by flush.
  */
 class AircraftData : public Data
 {
@@ -57,6 +74,14 @@ public:
      */
     explicit AircraftData(std::int32_t maxDist);
 
+    /**
+     * @brief Constructor
+     * @param maxDist     The max distance filter
+     * @param shards      The amount of shards; at least 1
+     * @param localRadius The radius for local plane projection; 0 to disable
+     */
+    AircraftData(std::int32_t maxDist, std::size_t shards, std::int32_t localRadius = 0);
+
     /**
      * @brief Get the reports for all processed aircrafts.
      * @param dest The destination string to append reports
@@ -66,6 +91,7 @@ public:
 
     /**
      * @brief Insert or update an Aircraft.
+     * Updates definitely out of range of the max distance filter are rejected.
      * @param aircraft The update
      * @return true on success, else false
      * @threadsafe
@@ -73,28 +99,140 @@ public:
     bool update(object::Object&& aircraft) override;
 
     /**
-     * @brief Process all aircrafts.
+     * @brief Queue an Aircraft update, to be applied on the next flush.
+     * @param aircraft The update
+     * @return true if queued, false if dropped because the queue is full
+     * @threadsafe
+     */
+    bool enqueue(object::Object&& aircraft) override;
+
+    /**
+     * @brief Queue a batch of Aircraft updates at once, to be applied on the next flush.
+     * @param aircrafts The updates, which are moved from
+     * @return the amount of queued updates, the rest was dropped because the queue is full
+     * @threadsafe
+     */
+    std::size_t enqueue(std::vector<object::Aircraft>& aircrafts);
+
+    /**
+     * @brief Apply all queued updates.
+     * @return the amount of applied updates; rejected ones are not counted
+     * @note Must not be called concurrently.
+     */
+    std::size_t flush();
+
+    /**
+     * @brief Get the amount of queued updates.
+     * @return the queue depth
+     * @threadsafe
+     */
+    std::size_t get_queueDepth() const;
+
+    /**
+     * @brief Get the amount of updates dropped, because the queue was full.
+     * @return the drops
+     * @threadsafe
+     */
+    std::uint64_t get_queueDrops() const;
+
+    /**
+     * @brief Process all aircrafts updated since they were processed last.
      * @param position The refered position
      * @param atmPress The atmospheric pressure
+     * @param age      Whether to age all aircrafts; must happen once per second
+     * @param updated  The string to append the reports of the processed aircrafts to, if any
      * @threadsafe
      */
-    void processAircrafts(const object::Position& position, double atmPress) noexcept;
+    void processAircrafts(const object::Position& position, double atmPress, bool age = true,
+                          std::string* updated = nullptr) noexcept;
+
+    /**
+     * @brief Record the latency until sent, for all updates processed since the last call.
+     * @note Call after the reports have been handed to the server.
+     * @threadsafe
+     */
+    void markSent() noexcept;
 
 private:
     /**
-     * @brief Insert an aircraft into the internal container.
+     * @brief A partition of the aircrafts.
+     */
+    struct Shard
+    {
+        /// Guard for this shard
+        std::mutex mutex;
+
+        /// Vector holding the aircrafts
+        std::vector<object::AircraftRecord> container;
+
+        /// Reports of the aircrafts, by container index; kept apart from the hot records
+        std::vector<std::string> reports;
+
+        /// Map aircraft addresses to container index
+        util::FlatIndex index;
+
+        /// Container indices of aircrafts, which are not outdated as of the last processing
+        std::vector<std::size_t> active;
+
+        /// Copy of the culling grid, as of the last processing
+        util::GeoGrid grid;
+    };
+
+    /**
+     * @brief Get the shard responsible for an aircraft.
+     * @param id The aircraft address
+     * @return the shard
+     */
+    Shard& shardOf(std::uint32_t id);
+
+    /**
+     * @brief Insert an aircraft into a shard.
+     * @param shard    The shard
      * @param aircraft The aircraft
      */
-    void insert(object::Aircraft&& aircraft);
+    void insert(Shard& shard, const object::AircraftRecord& aircraft);
+
+    /**
+     * @brief Remove an aircraft from a shard, by moving the last into its place.
+     * @param shard The shard
+     * @param index The container index
+     */
+    void remove(Shard& shard, std::size_t index);
+
+    /**
+     * @brief Process all aircrafts of a shard.
+     * @param shard   The shard
+     * @param age     Whether to age the aircrafts
+     * @param updated The string to append the reports of the processed aircrafts to, if any
+     */
+    void processShard(Shard& shard, bool age, std::string* updated);
 
     /// Processor for aircrafts
     processor::AircraftProcessor m_processor;
 
-    /// Vector holding the aircrafts
-    std::vector<object::Aircraft> m_container;
+    /// Grid to cull updates out of range, moved with the refered position
+    util::GeoGrid m_grid;
+
+    /// The shards; never resized
+    std::vector<Shard> m_shards;
+
+    /// Updates from the feeds, waiting to be applied
+    util::MpscQueue<object::Aircraft> m_queue;
+
+    /// Amount of stored aircrafts
+    util::Gauge& m_tracked;
+
+    /// Amount of reported aircrafts
+    util::Gauge& m_reported;
+
+    /// Aircrafts of a shard due for processing
+    std::vector<const object::AircraftRecord*> m_due;
+
+    /// Reports of the aircrafts due for processing
+    std::vector<std::string*> m_dueReports;
 
-    /// Map aircraft Id's to container index
-    std::unordered_map<std::string, std::size_t> m_index;
+    /// Feed metrics and receive time of the updates processed, but not yet sent
+    std::vector<std::pair<util::FeedMetrics*, std::chrono::steady_clock::time_point>> m_processed;
 };
 
 }  // namespace data
@@ -17,8 +17,10 @@
 
 #pragma once
 
+#include <functional>
 #include <mutex>
 #include <string>
+#include <utility>
 
 #include "util/defines.h"
 
@@ -46,12 +48,62 @@ public:
 
     /**
      * @brief Attempt to update this data.
+     * @note Objects are not polymorphic, so it must be of the type this data holds.
      * @param _1 The new Object
      * @return true on success, else false
      */
     virtual bool update(object::Object&& _1) = 0;
 
+    /**
+     * @brief Hand over an update, which may be applied later.
+     * By default it is applied immediately.
+     * @param _1 The new Object
+     * @return true on success, else false
+     */
+    virtual bool enqueue(object::Object&& _1)
+    {
+        return update(std::move(_1));
+    }
+
+    /**
+     * @brief Check whether this data was updated, since it was serialized last.
+     * @return true if updated, else false
+     * @threadsafe
+     */
+    bool isUpdated() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_updated;
+    }
+
+    /**
+     * @brief Set a function to call, whenever updates were handed over.
+     * @note Must be set before any update is handed over.
+     * @param notify The function; must be cheap and threadsafe
+     */
+    void set_notify(std::function<void()>&& notify)
+    {
+        m_notify = std::move(notify);
+    }
+
 protected:
+    /**
+     * @brief Call the notify function, if any.
+     */
+    void notify() const
+    {
+        if (m_notify)
+        {
+            m_notify();
+        }
+    }
+
     mutable std::mutex m_mutex;
+
+    /// Updated since serialized last; guarded by m_mutex
+    bool m_updated = true;
+
+    /// Called whenever updates were handed over
+    std::function<void()> m_notify;
 };
 }  // namespace data
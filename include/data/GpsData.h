@@ -21,11 +21,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <exception>
 #include <string>
 
 #include "object/GpsPosition.h"
 #include "processor/GpsProcessor.h"
+#include "util/MpscQueue.hpp"
 #include "util/defines.h"
 
 #include "Data.hpp"
@@ -73,6 +76,23 @@ public:
      */
     bool update(object::Object&& position) override;
 
+    /**
+     * @brief Queue a position update, to be applied on the next flush.
+     * @param position The new position
+     * @return true if queued, false if dropped because the queue is full
+     * @throw PositionAlreadyLocked if the position was locked before
+     * @threadsafe
+     */
+    bool enqueue(object::Object&& position) override;
+
+    /**
+     * @brief Apply all queued updates.
+     * If a good position is received in ground mode, the position gets locked.
+     * @return the amount of applied updates; rejected ones are not counted
+     * @note Must not be called concurrently.
+     */
+    std::size_t flush();
+
 private:
     /**
      * @brief Check whether the position is good enough.
@@ -87,10 +107,13 @@ private:
     processor::GpsProcessor m_processor;
 
     /// Locking state of the current position
-    bool m_positionLocked = false;
+    std::atomic<bool> m_positionLocked;
 
     /// Ground mode state
     bool m_groundMode = false;
+
+    /// Updates from the feeds, waiting to be applied
+    util::MpscQueue<object::GpsPosition> m_queue;
 };
 
 class GpsDataException : public std::exception
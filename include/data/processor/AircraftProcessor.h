@@ -21,10 +21,13 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "object/Aircraft.h"
+#include "object/AircraftRecord.h"
 #include "object/GpsPosition.h"
 #include "util/defines.h"
 
@@ -50,14 +53,42 @@ public:
      */
     explicit AircraftProcessor(std::int32_t maxDist);
 
+    /**
+     * @brief Constructor
+     * @param maxDist     The max distance filter
+     * @param localRadius The radius, within which aircrafts are projected on a local plane;
+     *                    0 to disable
+     */
+    AircraftProcessor(std::int32_t maxDist, std::int32_t localRadius);
+
     /**
      * @brief Process an aircraft.
+     * It is processed like the record the store would hold for it.
      * @param aircraft The Aircraft to process
      */
     void process(object::Aircraft& aircraft) override;
 
+    /**
+     * @brief Process a stored aircraft.
+     * @note Aircrafts with a position off the globe are not reported.
+     * @param aircraft The record to process
+     * @param dest     The report to replace
+     */
+    void process(const object::AircraftRecord& aircraft, std::string& dest);
+
+    /**
+     * @brief Process a batch of stored aircrafts.
+     * Relative positions of the whole batch are computed at once in SIMD packs.
+     * @note Aircrafts with a position off the globe are not reported.
+     * @param aircrafts The records to process
+     * @param reports   The reports to replace, one per record
+     */
+    void process(const std::vector<const object::AircraftRecord*>& aircrafts,
+                 const std::vector<std::string*>&                   reports);
+
     /**
      * @brief Set the refered position and atmospheric pressure.
+     * All terms depending only on them are computed here, once per cycle.
      * @param position The position
      * @param atmPress The pressure
      */
@@ -68,23 +99,59 @@ private:
      * @brief Calcutale an aircrafts position relative to the refered one.
      * @param aircraft The Aircraft
      */
-    void calculateRelPosition(const object::Aircraft& aircraft);
+    void calculateRelPosition(const object::AircraftRecord& aircraft);
+
+    /**
+     * @brief Calculate the position relative to the refered one on a local tangent plane.
+     *
+     * Instead of haversine and spherical bearing this takes a few multiplications. Compared to
+     * them, up to 60 degrees latitude, offsets differ by less than 0.02m at 10km, 0.1m at 20km
+     * and 1.5m at 50km; up to 80 degrees by 0.12m, 1m and 13m.
+     * The bearing differs by less than 0.003 degrees.
+     * @note Uses the angular distances of the last aircraft.
+     * @return true if within the local radius, else false and nothing is calculated
+     */
+    bool calculateLocalPosition();
+
+    /**
+     * @brief Calculate the relative positions of the first count aircrafts in the batch buffers.
+     * @param count The amount of aircrafts
+     */
+    void calculateRelPositions(std::size_t count);
+
+    /**
+     * @brief Calculate an aircrafts vertical distance to the refered position.
+     * @param aircraft The Aircraft
+     */
+    void calculateRelVertical(const object::AircraftRecord& aircraft);
 
     /**
-     * @brief Append PFLAU sentence to processing string.
+     * @brief Serialize an aircraft from the calculated relative position, if within max distance.
+     * @param aircraft The Aircraft
+     * @param dest     The report to replace; empty if out of range
+     */
+    void serialize(const object::AircraftRecord& aircraft, std::string& dest);
+
+    /**
+     * @brief Append PFLAU sentence to a report.
      * @param aircraft The Aircaft
+     * @param dest     The report
      */
-    void appendPFLAU(const object::Aircraft& aircraft);
+    void appendPFLAU(const object::AircraftRecord& aircraft, std::string& dest);
 
     /**
-     * @brief Append PFLAA sentence to processing string.
+     * @brief Append PFLAA sentence to a report.
      * @param aircraft The Aircaft
+     * @param dest     The report
      */
-    void appendPFLAA(const object::Aircraft& aircraft);
+    void appendPFLAA(const object::AircraftRecord& aircraft, std::string& dest);
 
     /// Max distance to process an aircraft
     const std::int32_t m_maxDistance;
 
+    /// Radius around the refered position, where aircrafts are projected on a plane; m
+    const std::int32_t m_localRadius;
+
     /// Refered position
     mutable object::Position m_refPosition{0.0, 0.0, 0};
 
@@ -94,6 +161,21 @@ private:
     /// Refered latitude as radian
     mutable double m_refRadLatitude = 0.0;
 
+    /// Sine of the refered latitude
+    mutable double m_refSinLatitude = 0.0;
+
+    /// Cosine of the refered latitude
+    mutable double m_refCosLatitude = 1.0;
+
+    /// Sine of the refered latitude, as computed by the batch kernel
+    mutable double m_batchRefSinLatitude = 0.0;
+
+    /// Cosine of the refered latitude, as computed by the batch kernel
+    mutable double m_batchRefCosLatitude = 1.0;
+
+    /// Height difference from QNE to the refered pressure; m
+    mutable std::int32_t m_refIcaoHeight = 0;
+
     /// Aircraft latitude as radian
     mutable double m_aircraftRadLatitude = 0.0;
 
@@ -126,6 +208,33 @@ private:
 
     /// Distance between Aircraft and refered position; m
     mutable std::int32_t m_distance = 0;
+
+    /**
+     * @brief Structure of arrays for batch processing, padded to whole SIMD packs.
+     */
+    struct Batch
+    {
+        /// Aircrafts latitude as radian; in
+        std::vector<double> latitude;
+
+        /// Aircrafts longitude as radian; in
+        std::vector<double> longitude;
+
+        /// Distance; m; out
+        std::vector<double> distance;
+
+        /// Relative bearing; deg; out
+        std::vector<double> bearing;
+
+        /// Cosine of the bearing; out
+        std::vector<double> north;
+
+        /// Sine of the bearing; out
+        std::vector<double> east;
+    };
+
+    /// Buffers for batch processing
+    Batch m_batch;
 };
 
 }  // namespace processor
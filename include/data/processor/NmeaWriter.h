@@ -0,0 +1,147 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "util/defines.h"
+
+namespace data
+{
+namespace processor
+{
+/**
+ * @brief Write NMEA sentences directly into a string.
+ *
+ * The checksum is computed while the bytes are written. Numbers are formatted equally to the
+ * respective printf conversions, without using the printf family.
+ */
+class NmeaWriter
+{
+public:
+    DEFAULT_DTOR(NmeaWriter)
+
+    /**
+     * @brief Constructor
+     * @param dest The string to append sentences to
+     */
+    explicit NmeaWriter(std::string& dest);
+
+    /**
+     * @brief Begin a new sentence.
+     * @param type The sentence type, without '$' (e.g. GPGGA)
+     * @return this
+     */
+    inline NmeaWriter& begin(const char* type)
+    {
+        m_checksum = 0;
+        m_dest.push_back('$');
+        return append(type);
+    }
+
+    /**
+     * @brief Append a field separator.
+     * @return this
+     */
+    inline NmeaWriter& field()
+    {
+        return append(',');
+    }
+
+    /**
+     * @brief Append a character.
+     * @param c The character
+     * @return this
+     */
+    inline NmeaWriter& append(char c)
+    {
+        m_checksum ^= static_cast<std::uint8_t>(c);
+        m_dest.push_back(c);
+        return *this;
+    }
+
+    /**
+     * @brief Append a null terminated string.
+     * @param str The string
+     * @return this
+     */
+    NmeaWriter& append(const char* str);
+
+    /**
+     * @brief Append a string.
+     * @param str The string
+     * @return this
+     */
+    inline NmeaWriter& append(const std::string& str)
+    {
+        return append(str.data(), str.size());
+    }
+
+    /**
+     * @brief Append a number of characters.
+     * @param str The first character
+     * @param len The amount of characters
+     * @return this
+     */
+    NmeaWriter& append(const char* str, std::size_t len);
+
+    /**
+     * @brief Append an integer, like printf %0<width>d.
+     * @param value The value
+     * @param width The min width, padded with zeros
+     * @return this
+     */
+    NmeaWriter& appendInt(std::int64_t value, std::uint32_t width = 0);
+
+    /**
+     * @brief Append a floating point number, like printf %0<width>.<decimals>lf.
+     * @param value    The value
+     * @param decimals The amount of decimal places; max 9
+     * @param width    The min width, padded with zeros
+     * @return this
+     */
+    NmeaWriter& appendFixed(double value, std::uint32_t decimals, std::uint32_t width = 0);
+
+    /**
+     * @brief Append an integer as upper case hexadecimal, like printf %0<width>X.
+     * @param value The value
+     * @param width The min width, padded with zeros; max 8
+     * @return this
+     */
+    NmeaWriter& appendHex(std::uint32_t value, std::uint32_t width = 0);
+
+    /**
+     * @brief End the sentence with '*', checksum and CRLF.
+     */
+    void finish();
+
+private:
+    /// The target string
+    std::string& m_dest;
+
+    /// The checksum of the current sentence
+    std::uint8_t m_checksum = 0;
+};
+}  // namespace processor
+}  // namespace data
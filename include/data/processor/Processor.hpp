@@ -21,11 +21,11 @@
 
 #pragma once
 
-#include <cstdio>
 #include <string>
 
 #include "util/defines.h"
-#include "util/math.hpp"
+
+#include "NmeaWriter.h"
 
 namespace data
 {
@@ -49,19 +49,6 @@ public:
     virtual void process(T& _1) = 0;
 
 protected:
-    /**
-     * @brief End the processing string with checksum and CRLF.
-     */
-    inline void finishSentence()
-    {
-        std::snprintf(m_buffer, sizeof(m_buffer), "%02x\r\n",
-                      math::checksum(m_buffer, sizeof(m_buffer)));
-        m_processed.append(m_buffer);
-    }
-
-    /// The internal buffer for format strings
-    char m_buffer[4096] = "";
-
     /// Processing string
     mutable std::string m_processed;
 };
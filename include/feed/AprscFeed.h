@@ -23,13 +23,26 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 #include <unordered_map>
 
 #include "config/Properties.h"
+#include "object/Aircraft.h"
+#include "object/GpsPosition.h"
 #include "util/defines.h"
 
 #include "Feed.h"
+#include "parameters.h"
+
+/// @def AF_FILTER_MARGIN
+/// Margin in meters added to the range of a generated filter
+#ifdef APRSCFEED_FILTER_MARGIN
+#    define AF_FILTER_MARGIN APRSCFEED_FILTER_MARGIN
+#else
+#    define AF_FILTER_MARGIN 10000
+#endif
 
 namespace feed
 {
@@ -42,6 +55,7 @@ class AprsParser;
 namespace data
 {
 class AircraftData;
+class GpsData;
 }  // namespace data
 
 namespace feed
@@ -57,14 +71,17 @@ public:
 
     /**
      * @brief Constructor
-     * @param name       The unique name
-     * @param properties The Properties
-     * @param data       The AircraftData container
-     * @param maxHeight  The max height filter
+     * @param name        The unique name
+     * @param properties  The Properties
+     * @param data        The AircraftData container
+     * @param maxHeight   The max height filter
+     * @param gpsData     The GpsData container, the position to generate the filter for
+     * @param maxDistance The max distance filter, the range to generate the filter for
      * @throw std::logic_error if login is not given, or from parent constructor
      */
     AprscFeed(const std::string& name, const config::Properties& propertyMap,
-              std::shared_ptr<data::AircraftData> data, std::int32_t maxHeight);
+              std::shared_ptr<data::AircraftData> data, std::int32_t maxHeight,
+              std::shared_ptr<data::GpsData> gpsData, std::int32_t maxDistance);
 
     /**
      * @brief Get this feeds Protocol.
@@ -77,15 +94,82 @@ public:
      */
     bool process(const std::string& response) override;
 
+    /**
+     * @brief Implement Feed::processBatch.
+     *
+     * All parsed aircrafts are queued at once.
+     */
+    bool processBatch(const std::vector<util::StringView>& responses) override;
+
     /**
      * @brief Get the login string.
      * @return the login
      */
     std::string get_login() const;
 
+    /**
+     * @brief Get the filter generated for the current position.
+     *
+     * The filter follows the position only once it moved further than AF_FILTER_MARGIN,
+     * hence it stays the same as long as it covers the max distance.
+     * @return the filter command, empty if not generated
+     * @threadsafe
+     */
+    std::string get_filter();
+
+    /**
+     * @brief Check whether the filter is generated.
+     * @return true if generated, else false
+     */
+    bool hasFilter() const;
+
 private:
+    /**
+     * @brief Implement Feed::classify.
+     *
+     * Only aircraft reports are parsed, see parser::classifyAprs.
+     */
+    bool classify(util::StringView line) const override;
+
+    /**
+     * @brief Generate the filter for a position.
+     * @param position The position
+     * @return the filter command
+     */
+    std::string makeFilter(const object::Position& position) const;
+
     /// Parser to unpack response from Client
     static parser::AprsParser s_parser;
+
+    /// AircraftData container
+    std::shared_ptr<data::AircraftData> m_aircraftData;
+
+    /// Reused batch of parsed aircrafts
+    std::vector<object::Aircraft> m_batch;
+
+    /// GpsData container
+    std::shared_ptr<data::GpsData> m_gpsData;
+
+    /// Range of the generated filter in km; 0, if without range
+    std::int64_t m_filterRange = 0;
+
+    /// Additional terms of the generated filter
+    std::string m_filterTerms;
+
+    /// Use the regular expressions, if a sentence could not be tokenized
+    const bool m_regexFallback;
+
+    /// Generate a filter?
+    bool m_autoFilter = false;
+
+    /// Position the current filter was generated for
+    object::Position m_filterCenter{0.0, 0.0, 0};
+
+    /// Current filter
+    std::string m_filter;
+
+    /// Mutex for the current filter
+    std::mutex m_filterMutex;
 };
 
 }  // namespace feed
@@ -75,6 +75,13 @@ public:
     bool process(const std::string& response) override;
 
 private:
+    /**
+     * @brief Implement Feed::classify.
+     *
+     * Only MDA sentences are parsed.
+     */
+    bool classify(util::StringView line) const override;
+
     /// Parser to unpack response from Client
     static parser::AtmosphereParser s_parser;
 };
@@ -21,18 +21,30 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "client/net/Endpoint.hpp"
 #include "config/Properties.h"
 #include "util/defines.h"
+#include "util/utility.hpp"
 
 namespace data
 {
 class Data;
 }  // namespace data
+namespace object
+{
+class Object;
+}  // namespace object
+namespace util
+{
+struct FeedMetrics;
+}  // namespace util
 
 namespace feed
 {
@@ -71,9 +83,18 @@ public:
     /**
      * @brief Handle client's response.
      * @param response The response
+     * @return false if the Client should stop, else true
      */
     virtual bool process(const std::string& response) = 0;
 
+    /**
+     * @brief Handle a batch of client's responses.
+     * By default every response is handled by process.
+     * @param responses The responses
+     * @return false if the Client should stop, else true
+     */
+    virtual bool processBatch(const std::vector<util::StringView>& responses);
+
 protected:
     /**
      * @brief Constructor
@@ -97,6 +118,33 @@ protected:
     /// Respective Data container
     std::shared_ptr<data::Data> m_data;
 
+    /// Metrics of this feed
+    util::FeedMetrics& m_metrics;
+
+    /// Monotonic time the current responses were received; zero if unknown
+    std::chrono::steady_clock::time_point m_received;
+
+    /**
+     * @brief Tag an update with this feeds metrics and the receive time.
+     * @param object The update
+     */
+    void tag(object::Object& object) const;
+
+    /**
+     * @brief Count lines unpacked by the parser, and record their latency.
+     * @param count The amount of lines
+     */
+    void parsed(std::size_t count);
+
+    /**
+     * @brief Check whether a line is of interest, before any parser runs.
+     * Lines of no interest are only counted as skipped.
+     * By default every line is of interest.
+     * @param line The line
+     * @return true if it should be parsed, else false
+     */
+    virtual bool classify(util::StringView line) const;
+
 private:
     /**
      * @brief Initialize the priority from the given properties.
@@ -106,12 +154,17 @@ private:
     /// Priority
     std::uint32_t m_priority;
 
+    /// Current response of a batch
+    std::string m_response;
+
 public:
     /**
      * Getters
      */
     GETTER_CR(name)
     GETTER_V(priority)
+    GETTER_R(metrics)
+    GETSET_V(received)
 };
 
 }  // namespace feed
@@ -75,6 +75,13 @@ public:
     bool process(const std::string& response) override;
 
 private:
+    /**
+     * @brief Implement Feed::classify.
+     *
+     * Only GGA sentences are parsed.
+     */
+    bool classify(util::StringView line) const override;
+
     /// Parser to unpack response from Client
     static parser::GpsParser s_parser;
 };
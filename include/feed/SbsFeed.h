@@ -24,8 +24,10 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "config/Properties.h"
+#include "object/Aircraft.h"
 #include "util/defines.h"
 
 #include "Feed.h"
@@ -76,9 +78,29 @@ public:
      */
     bool process(const std::string& response) override;
 
+    /**
+     * @brief Implement Feed::processBatch.
+     *
+     * All parsed aircrafts are queued at once.
+     */
+    bool processBatch(const std::vector<util::StringView>& responses) override;
+
 private:
+    /**
+     * @brief Implement Feed::classify.
+     *
+     * Only position messages (MSG,3) are parsed.
+     */
+    bool classify(util::StringView line) const override;
+
     /// Parser to unpack response from Client
     static parser::SbsParser s_parser;
+
+    /// AircraftData container
+    std::shared_ptr<data::AircraftData> m_aircraftData;
+
+    /// Reused batch of parsed aircrafts
+    std::vector<object::Aircraft> m_batch;
 };
 
 }  // namespace feed
@@ -75,6 +75,13 @@ public:
     bool process(const std::string& response) override;
 
 private:
+    /**
+     * @brief Implement Feed::classify.
+     *
+     * Only MWV sentences are parsed.
+     */
+    bool classify(util::StringView line) const override;
+
     /// Parser to unpack response from Client
     static parser::WindParser s_parser;
 };
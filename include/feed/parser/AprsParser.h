@@ -28,6 +28,7 @@
 
 #include "object/Aircraft.h"
 #include "util/defines.h"
+#include "util/utility.hpp"
 
 #include "Parser.hpp"
 
@@ -37,6 +38,9 @@ namespace parser
 {
 /**
  * @brief Implement Parser for APRS sentences.
+ *
+ * Sentences are tokenized in a single pass, without any copies. The former regular expressions are
+ * only used as fallback, if requested per sentence.
  */
 class AprsParser : public Parser<object::Aircraft>
 {
@@ -53,10 +57,36 @@ public:
      */
     bool unpack(const std::string& sentence, object::Aircraft& aircraft) noexcept override;
 
+    /**
+     * @brief Unpack into Aircraft from a view.
+     * @param sentence      The sentence to unpack
+     * @param aircraft      The Aircraft to unpack into
+     * @param regexFallback Use the regular expressions, if the sentence could not be tokenized
+     * @return true on success, else false
+     */
+    bool unpackView(util::StringView sentence, object::Aircraft& aircraft,
+                    bool regexFallback = false) noexcept;
+
     /// The max height filter
     static std::int32_t s_maxHeight;
 
 private:
+    /**
+     * @brief Unpack into Aircraft by tokenizing the sentence.
+     * @param sentence The string to unpack
+     * @param aircraft The Aircraft to unpack into
+     * @return true on success, else false
+     */
+    bool tokenize(util::StringView sentence, object::Aircraft& aircraft) noexcept;
+
+    /**
+     * @brief Unpack into Aircraft using the regular expressions.
+     * @param sentence The string to unpack
+     * @param aircraft The Aircraft to unpack into
+     * @return true on success, else false
+     */
+    bool unpackRegex(const std::string& sentence, object::Aircraft& aircraft) noexcept;
+
     /**
      * @brief Parse a Position.
      * @param match    The regex match
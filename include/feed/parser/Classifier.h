@@ -0,0 +1,73 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "util/utility.hpp"
+
+namespace feed
+{
+namespace parser
+{
+/**
+ * @brief Type of an APRS line, as determined without parsing it.
+ */
+enum class LineType : std::uint_fast8_t
+{
+    /// Position report of an aircraft
+    AIRCRAFT,
+    /// Any other packet, e.g. a receiver beacon or status
+    BEACON,
+    /// Comment of the server
+    COMMENT,
+    /// Anything else
+    GARBAGE
+};
+
+/**
+ * @brief Classify an APRS line.
+ *
+ * The markers of an aircraft report (>, :/...h, /A= and id) are searched in order, in blocks of
+ * 16 bytes at once where vector extensions are available. A line classified as aircraft may still
+ * be rejected by the parser, but no other line is parseable.
+ * @param line The line
+ * @return the type
+ */
+LineType classifyAprs(util::StringView line) noexcept;
+
+/**
+ * @brief Check whether a line is an SBS position message (MSG,3).
+ * @param line The line
+ * @return true if so, else false
+ */
+bool isSbsPosition(util::StringView line) noexcept;
+
+/**
+ * @brief Check whether a line is an NMEA sentence of a type, regardless of the talker.
+ * @param line The line
+ * @param type The sentence type, 3 characters (e.g. GGA)
+ * @return true if so, else false
+ */
+bool isNmea(util::StringView line, const char* type) noexcept;
+}  // namespace parser
+}  // namespace feed
@@ -26,6 +26,7 @@
 
 #include "object/Aircraft.h"
 #include "util/defines.h"
+#include "util/utility.hpp"
 
 #include "Parser.hpp"
 
@@ -35,6 +36,9 @@ namespace parser
 {
 /**
  * @brief Implement Parser for SBS sentences.
+ *
+ * Only MSG,3 sentences are accepted. Fields are viewed in place and numbers are decoded without
+ * locale, or any allocation.
  */
 class SbsParser : public Parser<object::Aircraft>
 {
@@ -50,6 +54,14 @@ public:
      */
     bool unpack(const std::string& sentence, object::Aircraft& aircraft) noexcept override;
 
+    /**
+     * @brief Unpack into Aircraft from a view.
+     * @param sentence The sentence to unpack
+     * @param aircraft The Aircraft to unpack into
+     * @return true on success, else false
+     */
+    bool unpackView(util::StringView sentence, object::Aircraft& aircraft) noexcept;
+
     /// The max height filter
     static std::int32_t s_maxHeight;
 
@@ -57,12 +69,12 @@ private:
     /**
      * @brief Parse a field in SBS and set respective values.
      * @param fieldNr  The field number
-     * @param field    The string in that field
+     * @param field    The view of that field
      * @param position The target position
      * @param aircraft The target Aircraft
      * @return true on success, else false
      */
-    bool parseField(std::uint32_t fieldNr, const std::string& field, object::Position& position,
+    bool parseField(std::uint32_t fieldNr, util::StringView field, object::Position& position,
                     object::Aircraft& aircraft) noexcept;
 };
 }  // namespace parser
@@ -22,7 +22,6 @@
 #pragma once
 
 #include <cstdint>
-#include <string>
 
 #include "impl/DateTimeImplBoost.h"
 #include "util/defines.h"
@@ -54,8 +53,10 @@ struct Movement
 /**
  * @brief Extend Object to an aircraft.
  */
-class Aircraft : public Object
+class Aircraft : public Updatable<Aircraft>
 {
+    friend class Updatable<Aircraft>;
+
 public:
     DEFAULT_DTOR(Aircraft)
 
@@ -130,20 +131,32 @@ public:
      */
     void set_idType(IdType type);
 
+    /**
+     * @brief Check whether an update may replace an aircraft, by target type.
+     * FLARM is never replaced by TRANSPONDER.
+     * @param type    The target type of the update
+     * @param oldType The target type of the aircraft
+     * @return true if yes, else false
+     */
+    static bool outranks(TargetType type, TargetType oldType)
+    {
+        return oldType == TargetType::TRANSPONDER || type == TargetType::FLARM;
+    }
+
 private:
     /**
      * @brief Assign an other aircrafts values to this.
      * @param other The other Aircraft
      */
-    void assign(Object&& other) override;
+    void assign(Aircraft&& other);
 
     /**
-     * @brief Override Object::canUpdate.
+     * @brief Extend Object::canUpdate by timestamp ordering and target type.
      */
-    bool canUpdate(const Object& other) const override;
+    bool canUpdate(const Aircraft& other) const;
 
-    /// Aircraft identifier
-    std::string m_id;
+    /// Aircraft address; 24-bit, regardless of the id type
+    std::uint32_t m_id = 0;
 
     /// Id type
     IdType m_idType;
@@ -166,11 +179,14 @@ private:
     /// Is full set of information available?
     bool m_fullInfo = false;
 
+    /// Updated, but not yet processed?
+    bool m_due = true;
+
 public:
     /**
      * Getters and setters
      */
-    GETSET_CR(id)
+    GETSET_V(id)
     GETTER_V(idType)
     GETSET_V(targetType)
     GETTER_V(aircraftType)
@@ -178,6 +194,7 @@ public:
     GETSET_CR(position)
     GETSET_CR(movement)
     GETSET_V(timeStamp)
+    GETSET_V(due)
 };
 
 }  // namespace object
@@ -0,0 +1,179 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include "impl/DateTimeImplBoost.h"
+#include "util/defines.h"
+
+#include "Aircraft.h"
+#include "GpsPosition.h"
+#include "TimeStamp.hpp"
+
+namespace util
+{
+struct FeedMetrics;
+}  // namespace util
+
+/// Fixed-point units per degree of latitude and longitude
+#define AR_DEGREE_UNITS 1e7
+
+namespace object
+{
+/**
+ * @brief Compact state of a stored Aircraft.
+ *
+ * Aircraft is only the view filled by the parsers, the store keeps these records instead. They
+ * are trivially copyable, without any heap memory, and fit a cache line. Coordinates are held
+ * in fixed-point, the movement at the resolution it is reported with in PFLAA.
+ */
+class AircraftRecord
+{
+public:
+    DEFAULT_CTOR(AircraftRecord)
+    DEFAULT_DTOR(AircraftRecord)
+
+    /**
+     * @brief Constructor
+     * @param aircraft The parsed Aircraft
+     */
+    explicit AircraftRecord(const Aircraft& aircraft);
+
+    /**
+     * @brief Try to update this record.
+     *
+     * The same rules as for Aircraft apply, inlined for the store.
+     * The result is counted in the metrics of the update, if any.
+     * @param update The update
+     * @return true on success, else false
+     */
+    bool tryUpdate(const AircraftRecord& update)
+    {
+        const bool accepted = (update.m_timeStamp > m_timeStamp) &&
+                              Aircraft::outranks(update.m_targetType, m_targetType) &&
+                              Object::outranks(update.m_lastPriority, m_lastPriority, m_updateAge);
+        update.countUpdate(accepted);
+        if (accepted)
+        {
+            *this       = update;
+            m_updateAge = 0;
+            m_due       = true;
+        }
+        return accepted;
+    }
+
+    /**
+     * @brief Increment the update age.
+     * @return this
+     */
+    AircraftRecord& operator++();
+
+    /**
+     * @brief Get the position.
+     * @return the position in degrees
+     */
+    Position get_position() const;
+
+    /**
+     * @brief Get the climb rate, rounded to one decimal like printf does.
+     * @return the climb rate in m/s; -0.0 if a negative one rounded to 0
+     */
+    double get_climbRate() const;
+
+private:
+    /**
+     * @brief Count the result of this update in its metrics, if any.
+     * @param accepted Whether it was accepted
+     */
+    void countUpdate(bool accepted) const;
+
+    /// Monotonic time the update was received; zero if unknown
+    std::chrono::steady_clock::time_point m_received;
+
+    /// Metrics of the feed the last update came from, if any
+    util::FeedMetrics* m_metrics = nullptr;
+
+    /// The timestamp of the last report
+    TimeStamp<timestamp::DateTimeImplBoost> m_timeStamp;
+
+    /// Aircraft address; 24-bit
+    std::uint32_t m_id = 0;
+
+    /// Latitude; deg / AR_DEGREE_UNITS
+    std::int32_t m_latitude = 0;
+
+    /// Longitude; deg / AR_DEGREE_UNITS
+    std::int32_t m_longitude = 0;
+
+    /// Altitude; m
+    std::int32_t m_altitude = 0;
+
+    /// Got last update with this priority
+    std::uint32_t m_lastPriority = 0;
+
+    /// Speed over ground; km/h
+    std::int16_t m_gndSpeed = 0;
+
+    /// Heading; deg
+    std::int16_t m_heading = 0;
+
+    /// Climb rate; dm/s in sign and magnitude, to keep the sign of a rate rounded to 0
+    std::uint16_t m_climbRate = 0;
+
+    /// Id type
+    Aircraft::IdType m_idType = Aircraft::IdType::ICAO;
+
+    /// Aircraft type
+    Aircraft::AircraftType m_aircraftType = Aircraft::AircraftType::POWERED_AIRCRAFT;
+
+    /// Target type
+    Aircraft::TargetType m_targetType = Aircraft::TargetType::TRANSPONDER;
+
+    /// Times processed without update
+    std::uint8_t m_updateAge = 0;
+
+    /// Is full set of information available?
+    bool m_fullInfo = false;
+
+    /// Updated, but not yet processed?
+    bool m_due = true;
+
+public:
+    /**
+     * Getters and setters
+     */
+    GETTER_V(received)
+    GETTER_V(metrics)
+    GETTER_V(id)
+    GETTER_V(altitude)
+    GETTER_V(gndSpeed)
+    GETTER_V(heading)
+    GETTER_V(idType)
+    GETTER_V(aircraftType)
+    GETSET_V(targetType)
+    GETTER_V(updateAge)
+    GETTER_V(fullInfo)
+    GETSET_V(due)
+};
+}  // namespace object
@@ -37,8 +37,10 @@ struct Climate;
 /**
  * @brief Extend Object to atmospheric information.
  */
-class Atmosphere : public Object
+class Atmosphere : public Updatable<Atmosphere>
 {
+    friend class Updatable<Atmosphere>;
+
 public:
     DEFAULT_DTOR(Atmosphere)
 
@@ -61,7 +63,7 @@ private:
     /**
      * @brief Extend Object::assign.
      */
-    void assign(Object&& other) override;
+    void assign(Atmosphere&& other);
 
     /// The atmospheric pressure
     double m_pressure = ICAO_STD_A;
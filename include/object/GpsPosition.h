@@ -49,8 +49,10 @@ struct Position
 /**
  * @brief Extend Object to a GPS position.
  */
-class GpsPosition : public Object
+class GpsPosition : public Updatable<GpsPosition>
 {
+    friend class Updatable<GpsPosition>;
+
 public:
     DEFAULT_DTOR(GpsPosition)
 
@@ -71,14 +73,14 @@ public:
 
 private:
     /**
-     * @brief Override Object::assign.
+     * @brief Extend Object::assign.
      */
-    void assign(Object&& other) override;
+    void assign(GpsPosition&& other);
 
     /**
-     * @brief Override Object::canUpdate.
+     * @brief Extend Object::canUpdate by timestamp ordering.
      */
-    bool canUpdate(const Object& other) const override;
+    bool canUpdate(const GpsPosition& other) const;
 
     /// The position
     Position m_position{0.0, 0.0, 0};
@@ -17,11 +17,17 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <string>
 
 #include "util/defines.h"
 
+namespace util
+{
+struct FeedMetrics;
+}  // namespace util
+
 /// Times until aircraft is outdated
 #define OBJ_OUTDATED 4
 
@@ -29,12 +35,14 @@ namespace object
 {
 /**
  * @brief Base object class
+ *
+ * Objects are not polymorphic, updates are arbitrated statically by Updatable.
  */
 class Object
 {
 public:
     DEFAULT_CTOR(Object)
-    DEFAULT_VIRTUAL_DTOR(Object)
+    DEFAULT_DTOR(Object)
 
     /**
      * @brief Constructor
@@ -42,25 +50,17 @@ public:
      */
     explicit Object(std::uint32_t priority);
 
-    /**
-     * @brief Try to update this Object.
-     * @note If the other Object cannot update this, nothing happens.
-     * @param other   The other Object
-     * @return true on success, else false
-     */
-    virtual bool tryUpdate(Object&& other);
-
     /**
      * @brief Set the string representation of this Objects data.
      * @param serialized The string representation
      */
-    virtual void set_serialized(std::string&& serialized);
+    void set_serialized(std::string&& serialized);
 
     /**
      * @brief Get the string representation of this Objects data.
      * @return m_serialized
      */
-    virtual const std::string& get_serialized() const;
+    const std::string& get_serialized() const;
 
     /**
      * @brief Increment the update age.
@@ -68,19 +68,41 @@ public:
      */
     Object& operator++();
 
+    /**
+     * @brief Check whether an update may replace an object, by priority.
+     * The priority must not be lower, unless the object is outdated.
+     * @param priority    The priority of the update
+     * @param oldPriority The priority the object got its last update with
+     * @param oldAge      The update age of the object
+     * @return true if yes, else false
+     */
+    static bool outranks(std::uint32_t priority, std::uint32_t oldPriority, std::uint32_t oldAge)
+    {
+        return priority >= oldPriority || oldAge >= OBJ_OUTDATED;
+    }
+
 protected:
     /**
      * @brief Assign other objects values to this.
      * @param other The other Object
      */
-    virtual void assign(Object&& other);
+    void assign(Object&& other);
 
     /**
      * @brief Check whether this Object can update the other one.
      * @param other   The other Object
      * @return true if yes, else false
      */
-    virtual bool canUpdate(const Object& other) const;
+    bool canUpdate(const Object& other) const
+    {
+        return outranks(m_lastPriority, other.m_lastPriority, other.m_updateAge);
+    }
+
+    /**
+     * @brief Count the result of this update in its metrics, if any.
+     * @param accepted Whether it was accepted
+     */
+    void countUpdate(bool accepted) const;
 
     /// Got last update with this priority.
     std::uint32_t m_lastPriority = 0;
@@ -91,10 +113,60 @@ protected:
     /// The string representation of this Objects data.
     std::string m_serialized;
 
+    /// Metrics of the feed this update came from, if any.
+    util::FeedMetrics* m_metrics = nullptr;
+
+    /// Monotonic time the update was received; zero if unknown.
+    std::chrono::steady_clock::time_point m_received;
+
 public:
     /**
-     * Getters
+     * Getters and setters
      */
+    GETTER_V(lastPriority)
     GETTER_V(updateAge)
+    GETSET_V(metrics)
+    GETSET_V(received)
+};
+
+/**
+ * @brief Extend Object by update arbitration, dispatched at compile time.
+ *
+ * T may hide canUpdate and assign of Object with its own, which usually call them in turn. They
+ * are resolved statically, so an update takes no virtual call and no RTTI.
+ * @tparam T The derived type; must befriend Updatable<T>, if it hides them privately
+ */
+template<typename T>
+class Updatable : public Object
+{
+public:
+    DEFAULT_CTOR(Updatable)
+    DEFAULT_DTOR(Updatable)
+
+    /**
+     * @brief Constructor
+     * @param priority The initial priority
+     */
+    explicit Updatable(std::uint32_t priority) : Object(priority) {}
+
+    /**
+     * @brief Try to update this Object.
+     * @note If the other Object cannot update this, nothing happens.
+     * The result is counted in the metrics of the other Object, if any, together with the
+     * latency since it was received.
+     * @param other   The other Object
+     * @return true on success, else false
+     */
+    bool tryUpdate(T&& other)
+    {
+        T&         self     = static_cast<T&>(*this);
+        const bool accepted = other.canUpdate(self);
+        other.countUpdate(accepted);
+        if (accepted)
+        {
+            self.assign(std::move(other));
+        }
+        return accepted;
+    }
 };
 }  // namespace object
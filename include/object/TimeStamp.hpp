@@ -26,6 +26,7 @@
 #include <string>
 
 #include "util/defines.h"
+#include "util/utility.hpp"
 
 namespace object
 {
@@ -40,6 +41,9 @@ enum class Format : std::uint8_t
     HH_MM_SS_FFF
 };
 
+/// Max distance between a time and now to be considered the same day; ms
+constexpr std::int64_t HALF_DAY_MS = 43200000;
+
 }  // namespace timestamp
 
 /**
@@ -62,17 +66,31 @@ public:
     TimeStamp(const std::string& value, timestamp::Format format);
 
     /**
-     * @brief Copy-Constructor
+     * @brief Parse a fixed width time string without throwing.
+     *
+     * The day is determined relative to the current time; times more than half a day ahead
+     * belong to the previous day, times more than half a day behind belong to the next day.
+     *
+     * @param value     The time string
+     * @param format    The format
+     * @param timeStamp The TimeStamp to set, unchanged on failure
+     * @return true on success, false if the time string is invalid
+     */
+    static bool tryParse(util::StringView value, timestamp::Format format,
+                         TimeStamp& timeStamp) noexcept;
+
+    /**
+     * @brief Copy-Constructor; trivial, so records holding a TimeStamp stay trivially copyable.
      * @param other The other TimeStamp
      */
-    TimeStamp(const TimeStamp& other);
+    TimeStamp(const TimeStamp& other) = default;
 
     /**
      * @brief Assign other TimeStamps value.
      * @param other The other TimeStamp
      * @return this
      */
-    TimeStamp& operator=(const TimeStamp& other);
+    TimeStamp& operator=(const TimeStamp& other) = default;
 
     /**
      * @brief Compare this value to be less than, or equals others.
@@ -91,57 +109,49 @@ private:
 
 template<typename DateTimeT>
 TimeStamp<DateTimeT>::TimeStamp(const std::string& value, timestamp::Format format)
-    : m_day(DateTimeT::day())
 {
-    std::int32_t h = 99, m = 99, s = 99, f = 9999;
-    try
+    if (!tryParse(util::StringView(value), format, *this))
     {
-        switch (format)
-        {
-            case timestamp::Format::HHMMSS:
-            {
-                h = std::stoi(value.substr(0, 2));
-                m = std::stoi(value.substr(2, 2));
-                s = std::stoi(value.substr(4, 2));
-                f = 0;
-            }
+        throw std::invalid_argument("");
+    }
+}
+
+template<typename DateTimeT>
+bool TimeStamp<DateTimeT>::tryParse(util::StringView value, timestamp::Format format,
+                                    TimeStamp& timeStamp) noexcept
+{
+    std::int32_t h = 99, m = 99, s = 99, f = 0;
+    const char*  str   = value.data();
+    bool         valid = false;
+    switch (format)
+    {
+        case timestamp::Format::HHMMSS:
+            valid = value.size() >= 6 && util::parseDigits(str, 2, h) &&
+                    util::parseDigits(str + 2, 2, m) && util::parseDigits(str + 4, 2, s);
             break;
-            case timestamp::Format::HH_MM_SS_FFF:
-            {
-                h = std::stoi(value.substr(0, 2));
-                m = std::stoi(value.substr(3, 2));
-                s = std::stoi(value.substr(6, 2));
-                f = std::stoi(value.substr(9, 3));
-            }
+        case timestamp::Format::HH_MM_SS_FFF:
+            valid = value.size() >= 12 && util::parseDigits(str, 2, h) &&
+                    util::parseDigits(str + 3, 2, m) && util::parseDigits(str + 6, 2, s) &&
+                    util::parseDigits(str + 9, 3, f);
             break;
-        }
     }
-    catch (const std::out_of_range&)
+    if (!valid || h > 23 || m > 59 || s > 59)
     {
-        throw std::invalid_argument("");
+        return false;
     }
-    if (h > 23 || m > 59 || s > 59 || f > 999)
+    std::int64_t time = static_cast<std::int64_t>(h * 3600000 + m * 60000 + s * 1000 + f);
+    std::int64_t now  = DateTimeT::now();
+    timeStamp.m_value = time;
+    timeStamp.m_day   = DateTimeT::day();
+    if (time - now > timestamp::HALF_DAY_MS)
     {
-        throw std::invalid_argument("");
+        --timeStamp.m_day;
     }
-    m_value = static_cast<std::int64_t>(h * 3600000 + m * 60000 + s * 1000 + f);
-    if (m_value >= DateTimeT::now())
+    else if (now - time > timestamp::HALF_DAY_MS)
     {
-        --m_day;
+        ++timeStamp.m_day;
     }
-}
-
-template<typename DateTimeT>
-TimeStamp<DateTimeT>::TimeStamp(const TimeStamp<DateTimeT>& other)
-    : m_value(other.m_value), m_day(other.m_day)
-{}
-
-template<typename DateTimeT>
-TimeStamp<DateTimeT>& TimeStamp<DateTimeT>::operator=(const TimeStamp<DateTimeT>& other)
-{
-    this->m_value = other.m_value;
-    this->m_day   = other.m_day;
-    return *this;
+    return true;
 }
 
 template<typename DateTimeT>
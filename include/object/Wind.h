@@ -34,7 +34,7 @@ struct Climate;
 /**
  * @brief Extend Object to wind information.
  */
-class Wind : public Object
+class Wind : public Updatable<Wind>
 {
 public:
     DEFAULT_DTOR(Wind)
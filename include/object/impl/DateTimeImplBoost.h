@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 
 #include "util/defines.h"
@@ -31,6 +32,9 @@ namespace timestamp
 {
 /**
  * @brief Provide time functions using boost.
+ *
+ * The clock is read only on refresh, so time and day are of coarse resolution.
+ * Day and time are published together, hence they are always consistent to each other.
  */
 class DateTimeImplBoost
 {
@@ -39,16 +43,32 @@ public:
     DEFAULT_DTOR(DateTimeImplBoost)
 
     /**
-     * @brief Get the amount of milliseconds since 00:00 UTC.
+     * @brief Get the amount of milliseconds since 00:00 UTC, as of the last refresh.
      * @return the milliseconds
      */
     static std::int64_t now();
 
     /**
-     * @brief Get the current day as incremental number.
+     * @brief Get the current day as incremental number, as of the last refresh.
      * @return the current day
      */
     static std::uint32_t day();
+
+    /**
+     * @brief Read the clock once and publish day and time.
+     * @note Call this once per batch of parsed sentences.
+     */
+    static void refresh();
+
+private:
+    /**
+     * @brief Get the published clock, refresh if never done.
+     * @return the day in upper, and milliseconds in lower 32 bits
+     */
+    static std::uint64_t clock();
+
+    /// The published clock; day in upper, milliseconds in lower 32 bits
+    static std::atomic<std::uint64_t> s_clock;
 };
 }  // namespace timestamp
 }  // namespace object
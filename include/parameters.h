@@ -46,6 +46,29 @@
 #    define CLIENT_CONNECT_WAIT_TIMEVAL 120
 #endif
 
+/**
+ * @def CLIENT_IO_THREADS
+ * Amount of threads handling all input-clients.
+ * [0 <= x]
+ * 0: Every client runs in its own thread.
+ * x: All clients share one event queue, run by x threads.
+ * The amount of CPU cores is a good choice, a single thread is sufficient for few feeds.
+ */
+#ifndef CLIENT_IO_THREADS
+#    define CLIENT_IO_THREADS 0
+#endif
+
+/**
+ * @def CLIENT_READ_BUFFER_SIZE
+ * Size of the buffer every input-client reads into, in bytes.
+ * [1 <= x], must be larger than the longest line
+ * All complete lines in the buffer are processed at once,
+ * longer lines are discarded.
+ */
+#ifndef CLIENT_READ_BUFFER_SIZE
+#    define CLIENT_READ_BUFFER_SIZE 65536
+#endif
+
 /**
  * @def APRSCCLIENT_BEACON_INTERVAL
  * APRSC servers are often configured to disconnect clients after some time without any sign of
@@ -56,6 +79,26 @@
 #    define APRSCCLIENT_BEACON_INTERVAL 600
 #endif
 
+/**
+ * @def APRSCCLIENT_FILTER_INTERVAL
+ * APRSC feeds with a generated filter check in this interval, whether the position moved such
+ * that the filter must be refreshed on the server. [1 <= x] seconds
+ */
+#ifndef APRSCCLIENT_FILTER_INTERVAL
+#    define APRSCCLIENT_FILTER_INTERVAL 60
+#endif
+
+/**
+ * @def APRSCFEED_FILTER_MARGIN
+ * Margin added to the max distance filter, for the range of a generated APRSC filter.
+ * [0 <= x] meters
+ * The filter is refreshed on the server whenever the position moved further than this margin,
+ * hence a moving position with a small margin causes frequent refreshes.
+ */
+#ifndef APRSCFEED_FILTER_MARGIN
+#    define APRSCFEED_FILTER_MARGIN 10000
+#endif
+
 /**
  * @def WINDCLIENT_RECEIVE_TIMEOUT
  * Due to unstable hardware/drivers, it became apparent that
@@ -81,6 +124,29 @@
 #    define SERVER_MAX_CLIENTS 3
 #endif
 
+/**
+ * @def SERVER_SEND_QUEUE_SIZE
+ * Max amount of cycles queued for a single client of the NMEA-server,
+ * including the one currently being written.
+ * [2 <= x]
+ * Writes happen asynchronously, so a slow client never blocks the others.
+ * If a client cannot keep up, its queue fills up and SERVER_DISCONNECT_SLOW_CLIENTS applies.
+ */
+#ifndef SERVER_SEND_QUEUE_SIZE
+#    define SERVER_SEND_QUEUE_SIZE 4
+#endif
+
+/**
+ * @def SERVER_DISCONNECT_SLOW_CLIENTS
+ * Policy for clients of the NMEA-server, whose send queue is full.
+ * [0, 1]
+ * 0: Drop the oldest queued cycle, the client skips outdated reports.
+ * 1: Disconnect the client, it may reconnect when its link has recovered.
+ */
+#ifndef SERVER_DISCONNECT_SLOW_CLIENTS
+#    define SERVER_DISCONNECT_SLOW_CLIENTS 0
+#endif
+
 /**
  * @def ESTIMATED_TRAFFIC
  * Initial amount of space reserved for aircrafts.
@@ -95,3 +161,40 @@
 #ifndef ESTIMATED_TRAFFIC
 #    define ESTIMATED_TRAFFIC 10
 #endif
+
+/**
+ * @def AIRCRAFT_DATA_SHARDS
+ * Amount of partitions of the aircraft store, each guarded by its own lock.
+ * [1 <= x]
+ * Feeds updating aircrafts in different shards do not block each other,
+ * and the periodic processing blocks only one shard at a time.
+ * Around the number of aircraft feeds (APRS, SBS) is sufficient.
+ */
+#ifndef AIRCRAFT_DATA_SHARDS
+#    define AIRCRAFT_DATA_SHARDS 4
+#endif
+
+/**
+ * @def AIRCRAFT_INGEST_QUEUE_SIZE
+ * Capacity of the queue, which passes aircraft updates from the feeds to the store.
+ * The queue is emptied once per cycle, so it must hold all updates received in between.
+ * [1 <= x], rounded up to a power of 2
+ * Updates exceeding the capacity are dropped and counted; a warning is logged.
+ * Every slot holds an aircraft, so this value directly affects memory usage.
+ */
+#ifndef AIRCRAFT_INGEST_QUEUE_SIZE
+#    define AIRCRAFT_INGEST_QUEUE_SIZE 8192
+#endif
+
+/**
+ * @def AIRCRAFT_CULLING_MARGIN
+ * Margin beyond the max distance filter, within which aircraft updates are stored at all.
+ * [0 <= x] meters
+ * Updates further away are rejected cheaply, before they take any memory or processing.
+ * The culling grid is rebuilt whenever the position moved further than this margin, hence a
+ * moving position with a small margin causes frequent rebuilds.
+ * Without a max distance filter nothing is culled.
+ */
+#ifndef AIRCRAFT_CULLING_MARGIN
+#    define AIRCRAFT_CULLING_MARGIN 5000
+#endif
@@ -21,18 +21,54 @@
 
 #pragma once
 
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "net/SocketException.h"
 #include "util/Logger.hpp"
 #include "util/defines.h"
 
+#include "Message.h"
+#include "parameters.h"
+
+/// @def S_SEND_QUEUE_SIZE
+/// The max amount of messages queued per connection
+#ifdef SERVER_SEND_QUEUE_SIZE
+#    define S_SEND_QUEUE_SIZE SERVER_SEND_QUEUE_SIZE
+#else
+#    define S_SEND_QUEUE_SIZE 4
+#endif
+
+/// @def S_DISCONNECT_SLOW_CLIENTS
+/// Whether to disconnect clients with full queue instead of dropping messages
+#ifdef SERVER_DISCONNECT_SLOW_CLIENTS
+#    define S_DISCONNECT_SLOW_CLIENTS SERVER_DISCONNECT_SLOW_CLIENTS
+#else
+#    define S_DISCONNECT_SLOW_CLIENTS 0
+#endif
+
 namespace server
 {
+/**
+ * @brief Policy for connections, which can not keep up with the written messages.
+ */
+enum class SlowClientPolicy : bool
+{
+    DROP_OLDEST,
+    DISCONNECT
+};
+
 /**
  * @brief TCP connection opened by the Server.
+ *
+ * Messages are queued and written asynchronously on the socket, so that writing never blocks
+ * the caller. All messages queued meanwhile are written at once in a single gather-write.
+ * Completion handlers run in the context of the NetworkInterface.
  * @tparam SocketT The type of socket implementation
  */
 template<typename SocketT>
@@ -40,31 +76,88 @@ class Connection final
 {
 public:
     NOT_COPYABLE(Connection)
-    DEFAULT_DTOR(Connection)
+
+    ~Connection() noexcept;
 
     /**
      * @brief Start a Connection.
-     * @param socket The socket
-     * @return a shared ptr to the Connection object
+     * @param socket    The socket
+     * @param queueSize The max amount of queued messages, including those being written
+     * @param policy    The policy to apply when the queue is full
+     * @return a unique ptr to the Connection object
      */
-    static std::unique_ptr<Connection<SocketT>> create(SocketT&& socket);
+    static std::unique_ptr<Connection<SocketT>> create(
+        SocketT&& socket, std::size_t queueSize = S_SEND_QUEUE_SIZE,
+        SlowClientPolicy policy = S_DISCONNECT_SLOW_CLIENTS ? SlowClientPolicy::DISCONNECT :
+                                                              SlowClientPolicy::DROP_OLDEST);
 
     /**
-     * @brief Write a message to the endpoint.
+     * @brief Queue a message to be written to the endpoint.
+     * @note Does not block.
      * @param msg The message
-     * @return true on success, else false
+     * @return false if the connection is broken, or too slow under SlowClientPolicy::DISCONNECT,
+     *         else true
+     * @threadsafe
      */
-    bool write(const std::string& msg);
+    bool write(const Message& msg);
+
+    /**
+     * @brief Get the amount of messages dropped due to a full queue.
+     * @return the amount
+     * @threadsafe
+     */
+    std::size_t get_drops() const;
 
 private:
+    /**
+     * @brief The socket along with its queue, shared with pending completion handlers.
+     */
+    struct Channel
+    {
+        Channel(SocketT&& socket, std::size_t queueSize) : socket(std::move(socket))
+        {
+            queue.reserve(queueSize);
+            inflight.reserve(queueSize);
+        }
+
+        SocketT              socket;
+        mutable std::mutex   mutex;
+        std::vector<Message> queue;
+        std::vector<Message> inflight;
+        std::size_t          drops  = 0;
+        bool                 failed = false;
+    };
+
     /**
      * @brief Constructor
-     * @param socket The socket
+     * @param socket    The socket
+     * @param queueSize The max amount of queued messages
+     * @param policy    The slow client policy
      */
-    explicit Connection(SocketT&& socket);
+    Connection(SocketT&& socket, std::size_t queueSize, SlowClientPolicy policy);
 
-    /// Socket
-    SocketT m_socket;
+    /**
+     * @brief Start writing all queued messages, if any.
+     * @note The channel must be locked.
+     * @param channel The channel
+     */
+    static void writeNext(const std::shared_ptr<Channel>& channel);
+
+    /**
+     * @brief Handler for completed writes.
+     * @param channel The channel
+     * @param success Whether the messages were written completely
+     */
+    static void handleWrite(const std::shared_ptr<Channel>& channel, bool success);
+
+    /// Socket and queue
+    std::shared_ptr<Channel> m_channel;
+
+    /// Max amount of queued messages
+    const std::size_t m_queueSize;
+
+    /// Policy for full queue
+    const SlowClientPolicy m_policy;
 
     /// IP address
     const std::string m_address;
@@ -77,28 +170,99 @@ public:
 };
 
 template<typename SocketT>
-std::unique_ptr<Connection<SocketT>> Connection<SocketT>::create(SocketT&& socket)
+Connection<SocketT>::~Connection() noexcept
 {
-    return std::unique_ptr<Connection<SocketT>>(new Connection<SocketT>(std::move(socket)));
+    std::lock_guard<std::mutex> lock(m_channel->mutex);
+    m_channel->socket.close();
 }
 
 template<typename SocketT>
-bool Connection<SocketT>::write(const std::string& msg)
+std::unique_ptr<Connection<SocketT>>
+    Connection<SocketT>::create(SocketT&& socket, std::size_t queueSize, SlowClientPolicy policy)
 {
+    return std::unique_ptr<Connection<SocketT>>(
+        new Connection<SocketT>(std::move(socket), queueSize, policy));
+}
+
+template<typename SocketT>
+bool Connection<SocketT>::write(const Message& msg)
+{
+    std::lock_guard<std::mutex> lock(m_channel->mutex);
+    if (m_channel->failed)
+    {
+        return false;
+    }
+    if (m_channel->queue.size() + m_channel->inflight.size() >= m_queueSize)
+    {
+        if (m_policy == SlowClientPolicy::DISCONNECT)
+        {
+            logger.debug("(Connection) send queue full: ", m_address);
+            return false;
+        }
+        ++m_channel->drops;
+        if (m_channel->queue.empty())
+        {
+            return true;
+        }
+        m_channel->queue.erase(m_channel->queue.begin());
+    }
+    m_channel->queue.push_back(msg);
+    if (m_channel->inflight.empty())
+    {
+        writeNext(m_channel);
+    }
+    return !m_channel->failed;
+}
+
+template<typename SocketT>
+std::size_t Connection<SocketT>::get_drops() const
+{
+    std::lock_guard<std::mutex> lock(m_channel->mutex);
+    return m_channel->drops;
+}
+
+template<typename SocketT>
+Connection<SocketT>::Connection(SocketT&& socket, std::size_t queueSize, SlowClientPolicy policy)
+    : m_channel(std::make_shared<Channel>(std::move(socket), queueSize)),
+      m_queueSize(queueSize),
+      m_policy(policy),
+      m_address(m_channel->socket.get_address())
+{}
+
+template<typename SocketT>
+void Connection<SocketT>::writeNext(const std::shared_ptr<Channel>& channel)
+{
+    if (channel->queue.empty())
+    {
+        return;
+    }
+    channel->inflight.swap(channel->queue);
     try
     {
-        return m_socket.write(msg);
+        std::shared_ptr<Channel> self = channel;
+        channel->socket.asyncWrite(channel->inflight,
+                                   [self](bool success) { handleWrite(self, success); });
     }
     catch (const net::SocketException& e)
     {
         logger.debug("(Connection) write: ", e.what());
+        channel->failed = true;
+        channel->inflight.clear();
     }
-    return false;
 }
 
 template<typename SocketT>
-Connection<SocketT>::Connection(SocketT&& socket)
-    : m_socket(std::move(socket)), m_address(m_socket.get_address())
-{}
+void Connection<SocketT>::handleWrite(const std::shared_ptr<Channel>& channel, bool success)
+{
+    std::lock_guard<std::mutex> lock(channel->mutex);
+    channel->inflight.clear();
+    if (!success)
+    {
+        channel->failed = true;
+        channel->queue.clear();
+        return;
+    }
+    writeNext(channel);
+}
 
 }  // namespace server
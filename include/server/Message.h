@@ -0,0 +1,131 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "util/defines.h"
+
+namespace server
+{
+class MessagePool;
+
+/**
+ * @brief An immutable, reference-counted message shared by all connections.
+ *
+ * Copies only increase the reference count. When the last copy is gone,
+ * the underlying buffer returns to its MessagePool.
+ */
+class Message
+{
+public:
+    DEFAULT_CTOR(Message)
+
+    Message(const Message& other) noexcept;
+    Message(Message&& other) noexcept;
+    ~Message() noexcept;
+
+    Message& operator=(Message other) noexcept;
+
+    /**
+     * @brief Get the content.
+     * @return the content, empty if this Message is empty
+     */
+    const std::string& get() const;
+
+    /**
+     * @brief Check whether this Message has content.
+     * @return true if not empty, else false
+     */
+    bool empty() const;
+
+private:
+    friend class MessagePool;
+
+    /**
+     * @brief Buffer holding the content along with its reference count.
+     */
+    struct Buffer
+    {
+        std::string                data;
+        std::atomic<std::uint32_t> refs;
+        std::weak_ptr<MessagePool> pool;
+    };
+
+    /**
+     * @brief Constructor
+     * @param buffer The buffer to take one reference of
+     */
+    explicit Message(Buffer* buffer) noexcept;
+
+    /// Shared buffer
+    Buffer* m_buffer = nullptr;
+};
+
+/**
+ * @brief A pool of buffers for Messages.
+ *
+ * The buffers keep their capacity, so that steady-state sealing does not allocate.
+ */
+class MessagePool : public std::enable_shared_from_this<MessagePool>
+{
+public:
+    NOT_COPYABLE(MessagePool)
+    ~MessagePool() noexcept;
+
+    /**
+     * @brief Create a MessagePool.
+     * @return a shared ptr to the MessagePool
+     */
+    static std::shared_ptr<MessagePool> create();
+
+    /**
+     * @brief Seal the content into a Message.
+     * @param content The content, is left empty with the capacity of a recycled buffer
+     * @return the Message
+     * @threadsafe
+     */
+    Message seal(std::string& content);
+
+private:
+    friend class Message;
+
+    DEFAULT_CTOR(MessagePool)
+
+    /**
+     * @brief Take back a buffer, which is not referenced anymore.
+     * @param buffer The buffer
+     * @threadsafe
+     */
+    void recycle(Message::Buffer* buffer) noexcept;
+
+    /// Buffers ready to be reused
+    std::vector<std::unique_ptr<Message::Buffer>> m_free;
+
+    std::mutex m_mutex;
+};
+}  // namespace server
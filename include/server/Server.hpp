@@ -31,9 +31,11 @@
 
 #include "net/impl/NetworkInterfaceImplBoost.h"
 #include "util/Logger.hpp"
+#include "util/Metrics.h"
 #include "util/defines.h"
 
 #include "Connection.hpp"
+#include "Message.h"
 #include "parameters.h"
 
 /// @def S_MAX_CLIENTS
@@ -86,10 +88,11 @@ public:
 
     /**
      * @brief Write a message to all clients.
-     * @param msg The msg to write
+     * @note Does not block on slow clients, the message is queued per Connection.
+     * @param msg The msg to write, shared by all connections
      * @threadsafe
      */
-    void send(const std::string& msg);
+    void send(const Message& msg);
 
 private:
     /**
@@ -119,6 +122,9 @@ private:
     /// Number of active connections
     std::uint8_t m_activeConnections = 0;
 
+    /// Number of active connections, as metric
+    util::Gauge& m_clients;
+
     /// Running state
     bool m_running = false;
 
@@ -130,12 +136,14 @@ private:
 
 template<typename SocketT>
 Server<SocketT>::Server(std::uint16_t port)
-    : m_netInterface(std::make_shared<net::NetworkInterfaceImplBoost>(port))
+    : m_netInterface(std::make_shared<net::NetworkInterfaceImplBoost>(port)),
+      m_clients(metrics.gauge("vfrb_server_clients", "Connected clients"))
 {}
 
 template<typename SocketT>
 Server<SocketT>::Server(std::shared_ptr<net::NetworkInterface<SocketT>> interface)
-    : m_netInterface(interface)
+    : m_netInterface(interface),
+      m_clients(metrics.gauge("vfrb_server_clients", "Connected clients"))
 {}
 
 template<typename SocketT>
@@ -178,6 +186,7 @@ void Server<SocketT>::stop()
             }
         }
         m_activeConnections = 0;
+        m_clients.set(0.0);
         m_netInterface->stop();
         lock.unlock();
         if (m_thread.joinable())
@@ -188,7 +197,7 @@ void Server<SocketT>::stop()
 }
 
 template<typename SocketT>
-void Server<SocketT>::send(const std::string& msg)
+void Server<SocketT>::send(const Message& msg)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
     if (msg.empty() || m_activeConnections == 0)
@@ -204,6 +213,7 @@ void Server<SocketT>::send(const std::string& msg)
                 logger.warn("(Server) lost connection to: ", it.get()->get_address());
                 it.reset();
                 --m_activeConnections;
+                m_clients.set(m_activeConnections);
             }
         }
     }
@@ -247,6 +257,7 @@ void Server<SocketT>::attemptConnection(bool error) noexcept
                     {
                         it = m_netInterface->startConnection();
                         ++m_activeConnections;
+                        m_clients.set(m_activeConnections);
                         logger.info("(Server) connection from: ", it->get_address());
                         break;
                     }
@@ -0,0 +1,90 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include <boost/asio.hpp>
+#include <boost/system/error_code.hpp>
+
+#include "util/defines.h"
+
+namespace server
+{
+/**
+ * @brief A minimal HTTP server on the loopback interface, serving all metrics.
+ *
+ * Every request is answered with the metrics in the Prometheus text format, so any path can be
+ * scraped.
+ */
+class StatsServer
+{
+public:
+    NOT_COPYABLE(StatsServer)
+
+    /**
+     * @brief Constructor
+     * @param port The local port
+     * @throw boost::system::system_error if the port cannot be bound
+     */
+    explicit StatsServer(std::uint16_t port);
+
+    ~StatsServer() noexcept;
+
+    /**
+     * @brief Run the StatsServer in its own thread.
+     */
+    void run();
+
+    /**
+     * @brief Stop the StatsServer.
+     * @note Blocks until the thread has returned.
+     */
+    void stop();
+
+private:
+    struct Session;
+
+    /**
+     * @brief Schedule to accept a connection.
+     */
+    void accept();
+
+    /**
+     * @brief Handler for accepting a connection.
+     * @param error   The error code
+     * @param session The accepted session
+     */
+    void handleAccept(const boost::system::error_code& error, std::shared_ptr<Session> session);
+
+    /// IO-service
+    boost::asio::io_service m_ioService;
+
+    /// Acceptor
+    boost::asio::ip::tcp::acceptor m_acceptor;
+
+    /// Internal thread
+    std::thread m_thread;
+};
+}  // namespace server
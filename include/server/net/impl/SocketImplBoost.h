@@ -21,11 +21,14 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
+#include <vector>
 
 #include <boost/asio.hpp>
 #include <boost/move/move.hpp>
 
+#include "server/Message.h"
 #include "util/defines.h"
 
 namespace server
@@ -56,12 +59,13 @@ public:
     std::string get_address() const;
 
     /**
-     * @brief Write a message on the socket to the endpoint.
-     * @param msg The message
-     * @return true on success, else false
+     * @brief Schedule writing messages on the socket to the endpoint in one gather-write.
+     * @note The messages must stay valid until the callback has been invoked.
+     * @param msgs     The messages
+     * @param callback The callback to invoke with the success state when done
      * @throw SocketException if the socket is closed
      */
-    bool write(const std::string& msg);
+    void asyncWrite(const std::vector<Message>& msgs, const std::function<void(bool)>& callback);
 
     /**
      * @brief Close the socket.
@@ -77,6 +81,9 @@ public:
 private:
     /// Underlying socket
     boost::asio::ip::tcp::socket m_socket;
+
+    /// Buffers of the pending write
+    std::vector<boost::asio::const_buffer> m_buffers;
 };
 }  // namespace net
 }  // namespace server
@@ -0,0 +1,119 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "util/defines.h"
+
+namespace util
+{
+/// Slots of a FlatIndex compared at once
+constexpr std::size_t FLATINDEX_GROUP = 8;
+
+/**
+ * @brief Map 32-bit keys to 32-bit values, in flat arrays with open addressing.
+ *
+ * Slots are probed in groups, all keys of a group are compared at once where vector extensions
+ * are available. Erased slots are marked, unless their group has a free slot anyway, and are
+ * purged when the table is rehashed.
+ * Keys must be less than 0xFFFFFFFE, the two highest values mark free and erased slots.
+ */
+class FlatIndex
+{
+public:
+    DEFAULT_DTOR(FlatIndex)
+
+    /// Value returned for keys not found
+    static constexpr std::uint32_t NONE = 0xFFFFFFFF;
+
+    FlatIndex();
+
+    /**
+     * @brief Find the value of a key.
+     * @param key The key
+     * @return the value, NONE if not found
+     */
+    std::uint32_t find(std::uint32_t key) const;
+
+    /**
+     * @brief Insert a key, or assign the value if it exists.
+     * @param key   The key
+     * @param value The value
+     */
+    void set(std::uint32_t key, std::uint32_t value);
+
+    /**
+     * @brief Erase a key.
+     * @param key The key
+     * @return true if erased, false if not found
+     */
+    bool erase(std::uint32_t key);
+
+    /**
+     * @brief Reserve slots for an amount of keys, without rehash.
+     * @param count The amount of keys
+     */
+    void reserve(std::size_t count);
+
+private:
+    /**
+     * @brief Find the slot of a key.
+     * @param key The key
+     * @return the slot, or the capacity if not found
+     */
+    std::size_t slotOf(std::uint32_t key) const;
+
+    /**
+     * @brief Get the first group to probe for a key.
+     * @param key The key
+     * @return the group
+     */
+    std::size_t groupOf(std::uint32_t key) const;
+
+    /**
+     * @brief Rebuild the table with a capacity, dropping all erased slots.
+     * @param capacity The capacity; a power of 2, at least FLATINDEX_GROUP
+     */
+    void rehash(std::size_t capacity);
+
+    /// Keys per slot
+    std::vector<std::uint32_t> m_keys;
+
+    /// Values per slot
+    std::vector<std::uint32_t> m_values;
+
+    /// Amount of keys
+    std::size_t m_size = 0;
+
+    /// Amount of slots not free, including erased ones
+    std::size_t m_used = 0;
+
+public:
+    /**
+     * Getters
+     */
+    GETTER_V(size)
+};
+}  // namespace util
@@ -0,0 +1,147 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "util/defines.h"
+
+namespace util
+{
+/// Cells of a GeoGrid per axis
+constexpr std::size_t GEOGRID_CELLS = 32;
+
+/**
+ * @brief A coarse grid around a center, to cull positions out of range without any trig.
+ *
+ * The bounding box of the circle with radius plus margin around the center is divided into
+ * cells; a cell is marked, if any of its points may be within that circle.
+ * Hence every position within the radius of any point up to the margin away from the center is
+ * contained, and the grid needs to be rebuilt only if the center moved any further.
+ */
+class GeoGrid
+{
+public:
+    DEFAULT_DTOR(GeoGrid)
+
+    /**
+     * @brief Constructor, for a grid containing everything.
+     */
+    GeoGrid();
+
+    /**
+     * @brief Constructor
+     * @param radius The radius; m, the grid contains everything if it reaches a quarter of the
+     *               circumference
+     * @param margin The distance the center may move without rebuild; m
+     */
+    GeoGrid(std::int32_t radius, std::int32_t margin);
+
+    /**
+     * @brief Move the center, and rebuild if it moved further than the margin since last built.
+     * @param latitude  The latitude; deg
+     * @param longitude The longitude; deg
+     * @return true if rebuilt, else false
+     */
+    bool moveTo(double latitude, double longitude);
+
+    /**
+     * @brief Check whether a position may be within the radius around the center.
+     * @note Everything is contained, until the grid was built.
+     * @param latitude  The latitude; deg
+     * @param longitude The longitude; deg
+     * @return true if it may, false if it is definitely not
+     */
+    bool contains(double latitude, double longitude) const
+    {
+        if (!m_built)
+        {
+            return true;
+        }
+        const double row = latitude - m_south;
+        double       col = longitude - m_longitude;
+        if (col > 180.0)
+        {
+            col -= 360.0;
+        }
+        else if (col < -180.0)
+        {
+            col += 360.0;
+        }
+        col += m_halfWidth;
+        // negated, so NaN is not contained either
+        if (!(row >= 0.0 && row <= m_height && col >= 0.0 && col <= 2.0 * m_halfWidth))
+        {
+            return false;
+        }
+        const std::size_t r = static_cast<std::size_t>(row * m_rowScale);
+        const std::size_t c = static_cast<std::size_t>(col * m_colScale);
+        return (m_cells[r < GEOGRID_CELLS ? r : GEOGRID_CELLS - 1] >>
+                (c < GEOGRID_CELLS ? c : GEOGRID_CELLS - 1)) &
+               1u;
+    }
+
+private:
+    /**
+     * @brief Rebuild the grid around the current center.
+     */
+    void build();
+
+    /// Radius plus margin; m
+    double m_range;
+
+    /// Distance the center may move without rebuild; m
+    double m_margin;
+
+    /// Whether the range is small enough to cull anything
+    bool m_enabled;
+
+    /// Whether the grid was built
+    bool m_built = false;
+
+    /// Latitude of the center as built; deg
+    double m_latitude = 0.0;
+
+    /// Longitude of the center as built; deg
+    double m_longitude = 0.0;
+
+    /// Southern border of the grid; deg
+    double m_south = 0.0;
+
+    /// Height of the grid; deg
+    double m_height = 0.0;
+
+    /// Half width of the grid, around the center; deg
+    double m_halfWidth = 0.0;
+
+    /// Rows per degree
+    double m_rowScale = 0.0;
+
+    /// Columns per degree
+    double m_colScale = 0.0;
+
+    /// Marked cells, a bit per column for every row
+    std::array<std::uint32_t, GEOGRID_CELLS> m_cells{};
+};
+}  // namespace util
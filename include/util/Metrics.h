@@ -0,0 +1,327 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "util/defines.h"
+
+namespace util
+{
+/// @def METRIC_PADDING
+/// Size of a metric, to keep the values of adjacent metrics in different cache lines
+#define METRIC_PADDING 64
+
+/// @def HISTOGRAM_BUCKETS
+/// Amount of buckets per histogram; the last one counts everything above ~58s
+#define HISTOGRAM_BUCKETS 100
+
+/**
+ * @brief A monotonic counter, cheap enough for the hot path.
+ *
+ * Counters are written by few threads, mostly a single one, so a relaxed atomic on its own cache
+ * line does not contend.
+ */
+class Counter
+{
+public:
+    DEFAULT_CTOR(Counter)
+    DEFAULT_DTOR(Counter)
+    NOT_COPYABLE(Counter)
+
+    /**
+     * @brief Add to the counter.
+     * @param value The value to add (default: 1)
+     * @threadsafe
+     */
+    void add(std::uint64_t value = 1) noexcept
+    {
+        m_value.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the current value.
+     * @return the value
+     * @threadsafe
+     */
+    std::uint64_t get() const noexcept
+    {
+        return m_value.load(std::memory_order_relaxed);
+    }
+
+private:
+    /// The value
+    std::atomic<std::uint64_t> m_value{0};
+
+    /// Padding to the next metric
+    char m_padding[METRIC_PADDING - sizeof(std::atomic<std::uint64_t>)];
+};
+
+/**
+ * @brief A value that may go up and down.
+ */
+class Gauge
+{
+public:
+    DEFAULT_CTOR(Gauge)
+    DEFAULT_DTOR(Gauge)
+    NOT_COPYABLE(Gauge)
+
+    /**
+     * @brief Set the value.
+     * @param value The value
+     * @threadsafe
+     */
+    void set(double value) noexcept
+    {
+        m_value.store(value, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the current value.
+     * @return the value
+     * @threadsafe
+     */
+    double get() const noexcept
+    {
+        return m_value.load(std::memory_order_relaxed);
+    }
+
+private:
+    /// The value
+    std::atomic<double> m_value{0.0};
+
+    /// Padding to the next metric
+    char m_padding[METRIC_PADDING - sizeof(std::atomic<double>)];
+};
+
+/**
+ * @brief A log-linear histogram of latencies, with microsecond resolution.
+ *
+ * Each power of two is split into 4 linear buckets, so the relative error is at most 25%
+ * from 1us up to a minute, while recording is just a few relaxed atomic additions.
+ */
+class Histogram
+{
+public:
+    DEFAULT_CTOR(Histogram)
+    DEFAULT_DTOR(Histogram)
+    NOT_COPYABLE(Histogram)
+
+    /**
+     * @brief Record a latency.
+     * @param latency The latency; negative values count as 0
+     * @param count   The amount of observations with this latency (default: 1)
+     * @threadsafe
+     */
+    void observe(std::chrono::steady_clock::duration latency, std::uint64_t count = 1) noexcept;
+
+    /**
+     * @brief Get the amount of observations.
+     * @return the count
+     * @threadsafe
+     */
+    std::uint64_t get_count() const noexcept;
+
+    /**
+     * @brief Get the sum of all observations.
+     * @return the sum in microseconds
+     * @threadsafe
+     */
+    std::uint64_t get_sum() const noexcept;
+
+    /**
+     * @brief Get the amount of observations in a bucket.
+     * @param bucket The bucket
+     * @return the count
+     * @threadsafe
+     */
+    std::uint64_t get_count(std::size_t bucket) const noexcept;
+
+    /**
+     * @brief Estimate a quantile, as the upper bound of the bucket containing it.
+     * @param q The quantile in [0, 1]
+     * @return the latency in microseconds, 0 if empty
+     * @threadsafe
+     */
+    std::uint64_t quantile(double q) const noexcept;
+
+    /**
+     * @brief Get the bucket of a latency.
+     * @param micros The latency in microseconds
+     * @return the bucket
+     */
+    static std::size_t bucketOf(std::uint64_t micros) noexcept;
+
+    /**
+     * @brief Get the exclusive upper bound of a bucket.
+     * @param bucket The bucket
+     * @return the bound in microseconds
+     */
+    static std::uint64_t boundOf(std::size_t bucket) noexcept;
+
+private:
+    /// Observations per bucket
+    std::atomic<std::uint64_t> m_buckets[HISTOGRAM_BUCKETS] = {};
+
+    /// Amount of observations
+    std::atomic<std::uint64_t> m_count{0};
+
+    /// Sum of observations in microseconds
+    std::atomic<std::uint64_t> m_sum{0};
+};
+
+/**
+ * @brief Counters of an input feed.
+ *
+ * Latencies are measured from receiving a line up to the end of each stage.
+ * Processing and sending only applies to aircrafts.
+ */
+struct FeedMetrics
+{
+    /// Bytes of all lines read
+    Counter bytesRead;
+
+    /// Lines read
+    Counter linesRead;
+
+    /// Lines unpacked by the parser
+    Counter linesParsed;
+
+    /// Lines skipped before parsing, because of no interest
+    Counter linesSkipped;
+
+    /// Lines rejected by the parser
+    Counter linesRejected;
+
+    /// Updates applied to the data
+    Counter updatesAccepted;
+
+    /// Updates rejected, e.g. because of a higher priority
+    Counter updatesRejected;
+
+    /// Updates culled, because out of range
+    Counter updatesCulled;
+
+    /// Reconnects of the client
+    Counter reconnects;
+
+    /// Latency until unpacked by the parser
+    Histogram parseLatency;
+
+    /// Latency until applied to the data
+    Histogram storeLatency;
+
+    /// Latency until processed for report
+    Histogram processLatency;
+
+    /// Latency until handed to the server
+    Histogram sendLatency;
+
+    /**
+     * @brief Count an update as accepted or rejected, and observe the store latency if accepted.
+     * @param accepted Whether it was accepted
+     * @param received The monotonic time it was received; zero if unknown
+     */
+    void countUpdate(bool accepted, std::chrono::steady_clock::time_point received) noexcept;
+};
+
+/**
+ * @brief Registry of all metrics, to render them in the Prometheus text format.
+ *
+ * Metrics are registered once and live as long as the registry, so references to them may be
+ * kept and updated without any lookup.
+ */
+class Metrics
+{
+public:
+    NOT_COPYABLE(Metrics)
+    DEFAULT_CTOR(Metrics)
+    DEFAULT_DTOR(Metrics)
+
+    /**
+     * @brief Get the metrics of a feed, registering them if necessary.
+     * @param name The feed name
+     * @return the metrics
+     * @threadsafe
+     */
+    FeedMetrics& feed(const std::string& name);
+
+    /**
+     * @brief Get a gauge, registering it if necessary.
+     * @param name The metric name
+     * @param help The description
+     * @return the gauge
+     * @threadsafe
+     */
+    Gauge& gauge(const std::string& name, const std::string& help);
+
+    /**
+     * @brief Render all metrics in the Prometheus text exposition format.
+     * @param dest The destination string
+     * @threadsafe
+     */
+    void render(std::string& dest) const;
+
+    /**
+     * @brief Summarize the latencies of all feeds, one line per feed and stage.
+     * @return the summary lines, omitting stages without observations
+     * @threadsafe
+     */
+    std::vector<std::string> summarizeLatencies() const;
+
+private:
+    /**
+     * @brief A registered gauge.
+     */
+    struct NamedGauge
+    {
+        /// Metric name
+        std::string name;
+
+        /// Description
+        std::string help;
+
+        /// The gauge
+        std::unique_ptr<Gauge> gauge;
+    };
+
+    /// Feed metrics by feed name
+    std::vector<std::pair<std::string, std::unique_ptr<FeedMetrics>>> m_feeds;
+
+    /// Gauges
+    std::vector<NamedGauge> m_gauges;
+
+    mutable std::mutex m_mutex;
+};
+}  // namespace util
+
+/// Extern Metrics instance
+extern util::Metrics metrics;
@@ -0,0 +1,275 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "util/defines.h"
+
+namespace util
+{
+/**
+ * @brief A bounded lock-free queue for multiple producers and a single consumer.
+ *
+ * Every slot carries a sequence number, which tells producers and the consumer whether the slot
+ * is free, or filled. Pushing to a full queue fails and is counted as drop.
+ * @tparam T The value type; must be default constructible and move assignable
+ */
+template<typename T>
+class MpscQueue
+{
+public:
+    NOT_COPYABLE(MpscQueue)
+    DEFAULT_DTOR(MpscQueue)
+
+    /**
+     * @brief Constructor
+     * @param capacity The min capacity, rounded up to a power of 2
+     */
+    explicit MpscQueue(std::size_t capacity);
+
+    /**
+     * @brief Push a value, callable from any thread.
+     * @param value The value
+     * @return true on success, false if the queue was full
+     * @threadsafe
+     */
+    bool push(T&& value);
+
+    /**
+     * @brief Push multiple values at once, callable from any thread.
+     * The values are placed in consecutive slots, claimed by a single atomic operation.
+     * @param values The values to move from
+     * @param count  The amount of values
+     * @return the amount of values pushed, the rest was dropped because the queue was full
+     * @threadsafe
+     */
+    std::size_t push(T* values, std::size_t count);
+
+    /**
+     * @brief Pop the oldest value, callable from only one thread at a time.
+     * @param value The value to move into
+     * @return true on success, false if the queue was empty
+     */
+    bool pop(T& value);
+
+    /**
+     * @brief Get the amount of values currently queued.
+     * @return the depth
+     * @threadsafe
+     */
+    std::size_t get_depth() const;
+
+    /**
+     * @brief Get the amount of values dropped, because the queue was full.
+     * @return the drops
+     * @threadsafe
+     */
+    std::uint64_t get_drops() const;
+
+    /**
+     * @brief Get the capacity.
+     * @return the capacity
+     */
+    std::size_t get_capacity() const;
+
+private:
+    /**
+     * @brief A slot in the ring.
+     */
+    struct Cell
+    {
+        /// Equals the position, if free for a producer; position + 1, if filled
+        std::atomic<std::size_t> sequence;
+
+        /// The value
+        T value;
+    };
+
+    /**
+     * @brief Round up to the next power of 2.
+     * @param value The value
+     * @return the power of 2
+     */
+    static std::size_t powerOf2(std::size_t value);
+
+    /// The ring
+    std::vector<Cell> m_cells;
+
+    /// Capacity - 1
+    const std::size_t m_mask;
+
+    /// Keep producers and consumer positions on separate cache lines
+    char m_pad0[64];
+
+    /// Position of the next push
+    std::atomic<std::size_t> m_enqueuePos;
+
+    /// Keep producers and consumer positions on separate cache lines
+    char m_pad1[64];
+
+    /// Position of the next pop
+    std::atomic<std::size_t> m_dequeuePos;
+
+    /// Amount of dropped values
+    std::atomic<std::uint64_t> m_drops;
+};
+
+template<typename T>
+MpscQueue<T>::MpscQueue(std::size_t capacity)
+    : m_cells(powerOf2(capacity)),
+      m_mask(m_cells.size() - 1),
+      m_enqueuePos(0),
+      m_dequeuePos(0),
+      m_drops(0)
+{
+    for (std::size_t i = 0; i < m_cells.size(); ++i)
+    {
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template<typename T>
+bool MpscQueue<T>::push(T&& value)
+{
+    Cell*       cell;
+    std::size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        cell              = &m_cells[pos & m_mask];
+        std::size_t   seq = cell->sequence.load(std::memory_order_acquire);
+        std::intptr_t dif = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+        if (dif == 0)
+        {
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (dif < 0)
+        {
+            m_drops.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+    cell->value = std::move(value);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename T>
+std::size_t MpscQueue<T>::push(T* values, std::size_t count)
+{
+    std::size_t n   = 0;
+    std::size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        std::size_t dequeued = m_dequeuePos.load(std::memory_order_acquire);
+        std::size_t used     = pos > dequeued ? pos - dequeued : 0;
+        n                    = std::min(count, m_cells.size() - std::min(used, m_cells.size()));
+        if (n == 0)
+        {
+            break;
+        }
+        // slots are freed in order, so if the last one is free, all before are as well
+        std::size_t last = pos + n - 1;
+        if (m_cells[last & m_mask].sequence.load(std::memory_order_acquire) == last)
+        {
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else
+        {
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        Cell& cell = m_cells[(pos + i) & m_mask];
+        cell.value = std::move(values[i]);
+        cell.sequence.store(pos + i + 1, std::memory_order_release);
+    }
+    if (n < count)
+    {
+        m_drops.fetch_add(count - n, std::memory_order_relaxed);
+    }
+    return n;
+}
+
+template<typename T>
+bool MpscQueue<T>::pop(T& value)
+{
+    std::size_t pos  = m_dequeuePos.load(std::memory_order_relaxed);
+    Cell&       cell = m_cells[pos & m_mask];
+    if (cell.sequence.load(std::memory_order_acquire) != pos + 1)
+    {
+        return false;
+    }
+    value = std::move(cell.value);
+    cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+    m_dequeuePos.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename T>
+std::size_t MpscQueue<T>::get_depth() const
+{
+    std::size_t dequeued = m_dequeuePos.load(std::memory_order_relaxed);
+    std::size_t enqueued = m_enqueuePos.load(std::memory_order_relaxed);
+    return enqueued > dequeued ? enqueued - dequeued : 0;
+}
+
+template<typename T>
+std::uint64_t MpscQueue<T>::get_drops() const
+{
+    return m_drops.load(std::memory_order_relaxed);
+}
+
+template<typename T>
+std::size_t MpscQueue<T>::get_capacity() const
+{
+    return m_cells.size();
+}
+
+template<typename T>
+std::size_t MpscQueue<T>::powerOf2(std::size_t value)
+{
+    std::size_t result = 1;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+
+}  // namespace util
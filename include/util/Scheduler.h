@@ -0,0 +1,124 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include "util/defines.h"
+
+namespace util
+{
+/**
+ * @brief Schedule periodic streams at wall-clock boundaries, and wake early on demand.
+ *
+ * Every stream is due at the multiples of its period since the epoch, so streams with
+ * commensurable periods are due together, and no drift accumulates.
+ * A stream, which missed boundaries, is due once and continues at the next boundary.
+ */
+class Scheduler
+{
+public:
+    NOT_COPYABLE(Scheduler)
+    DEFAULT_DTOR(Scheduler)
+
+    /// @typedef Clock
+    /// The clock to wait on
+    using Clock = std::chrono::steady_clock;
+
+    Scheduler();
+
+    /**
+     * @brief Add a stream.
+     * @param period The period; zero for a stream, which is never due by itself
+     * @return the stream id
+     */
+    std::size_t add(Clock::duration period);
+
+    /**
+     * @brief Wait until any stream is due, or notify was called.
+     * @return true if notified, else false
+     */
+    bool wait();
+
+    /**
+     * @brief Check whether a stream is due as of the last wait, and schedule its next cycle if so.
+     * @param stream The stream id
+     * @return true if due, else false
+     */
+    bool due(std::size_t stream);
+
+    /**
+     * @brief Wake up the waiting thread.
+     * Only the first call between two waits takes a lock.
+     * @threadsafe
+     */
+    void notify() noexcept;
+
+private:
+    /**
+     * @brief A periodic stream.
+     */
+    struct Stream
+    {
+        /// The period; zero if none
+        Clock::duration period;
+
+        /// Time the stream is due next
+        Clock::time_point deadline;
+    };
+
+    /**
+     * @brief Get the first boundary of a period after the current time.
+     * @param period The period
+     * @return the boundary
+     */
+    Clock::time_point nextBoundary(Clock::duration period) const;
+
+    /**
+     * @brief Take the current time of both clocks.
+     */
+    void takeTime();
+
+    /// The streams
+    std::vector<Stream> m_streams;
+
+    /// Current time, as of the last wait
+    Clock::time_point m_now;
+
+    /// Current wall-clock time since epoch, as of the last wait
+    Clock::duration m_wallNow;
+
+    /// Whether notify was called since the last wait
+    std::atomic<bool> m_notified;
+
+    /// Guard for the condition
+    std::mutex m_mutex;
+
+    /// Condition to wait on
+    std::condition_variable m_condition;
+};
+}  // namespace util
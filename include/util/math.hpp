@@ -60,6 +60,9 @@ const double M_2_FEET = 3.28084;
 /// The circular number
 const double PI = std::acos(-1.0);
 
+/// Mean radius of the earth; m
+const double EARTH_RADIUS = 6371000.0;
+
 /**
  * @brief Convert degree to radian.
  * @param degree The degrees
@@ -80,6 +83,23 @@ inline double degree(double radian)
     return (radian * 180.0) / PI;
 }
 
+/**
+ * @brief Calculate the great circle distance between two positions with the haversine formula.
+ * @param latitude1  The latitude of the first position; deg
+ * @param longitude1 The longitude of the first position; deg
+ * @param latitude2  The latitude of the second position; deg
+ * @param longitude2 The longitude of the second position; deg
+ * @return the distance; m
+ */
+inline double distance(double latitude1, double longitude1, double latitude2, double longitude2)
+{
+    const double a =
+        std::pow(std::sin(radian(latitude2 - latitude1) / 2.0), 2.0) +
+        std::cos(radian(latitude1)) * std::cos(radian(latitude2)) *
+            std::pow(std::sin(radian(longitude2 - longitude1) / 2.0), 2.0);
+    return EARTH_RADIUS * 2.0 * std::atan2(std::sqrt(a), std::sqrt(1.0 - a));
+}
+
 /**
  * @brief Convert double to int, round to nearest number.
  * @param value The floating point value
@@ -91,6 +111,28 @@ inline std::int32_t doubleToInt(double value)
                             static_cast<std::int32_t>(value - 0.5);
 }
 
+/**
+ * @brief Scale a non-negative value and round it to an integer, like printf does.
+ * Half way cases are decided on the exact product, and tie to even.
+ * @param magnitude The value; not negative and small enough to scale into 53 bits
+ * @param scale     The scale
+ * @return the rounded, scaled value
+ */
+inline std::uint64_t roundScaled(double magnitude, double scale)
+{
+    double        scaled   = magnitude * scale;
+    double        error    = std::fma(magnitude, scale, -scaled);
+    double        whole    = std::floor(scaled);
+    double        fraction = scaled - whole;
+    std::uint64_t digits   = static_cast<std::uint64_t>(whole);
+    if (fraction > 0.5 ||
+        (fraction == 0.5 && (error > 0.0 || (error == 0.0 && (digits & 1) == 1))))
+    {
+        ++digits;
+    }
+    return digits;
+}
+
 /**
  * @brief Convert ( degree, minute-as-decimal ) to degree.
  * @param degMin The degree-minute value
@@ -0,0 +1,273 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX__) || defined(__SSE2__)
+#    include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#    include <arm_neon.h>
+#endif
+
+/**
+ * @file simd.hpp
+ * Branch-free math on packs of doubles, for batch computations.
+ *
+ * Packs use the compilers vector extensions, which are lowered to AVX, SSE2 or NEON as the
+ * target allows, else to scalar code. Without vector extensions a pack is a plain double.
+ * Build with -mavx (or -march=native) for packs of 4.
+ * Functions are accurate to about 1 ulp in the documented ranges.
+ */
+namespace math
+{
+namespace simd
+{
+#if defined(__GNUC__)
+/// @def SIMD_LANES
+/// Amount of doubles in a pack, to fill a native vector register
+#    if defined(__AVX__)
+#        define SIMD_LANES 4
+#    else
+#        define SIMD_LANES 2
+#    endif
+
+/// @typedef Pack
+/// Pack of doubles
+using Pack = double __attribute__((vector_size(SIMD_LANES * sizeof(double))));
+
+/// @typedef Mask
+/// Result of comparing packs; all bits set in true lanes
+using Mask = std::int64_t __attribute__((vector_size(SIMD_LANES * sizeof(double))));
+#else
+#    define SIMD_LANES 1
+using Pack = double;
+using Mask = bool;
+#endif
+
+/**
+ * @brief Load a pack from memory.
+ * @param src The first double
+ * @return the pack
+ */
+inline Pack load(const double* src)
+{
+    Pack pack;
+    std::memcpy(&pack, src, sizeof(pack));
+    return pack;
+}
+
+/**
+ * @brief Store a pack to memory.
+ * @param dest The first double
+ * @param pack The pack
+ */
+inline void store(double* dest, Pack pack)
+{
+    std::memcpy(dest, &pack, sizeof(pack));
+}
+
+/**
+ * @brief Get a pack with all lanes set to a value.
+ * @param value The value
+ * @return the pack
+ */
+inline Pack splat(double value)
+{
+    return Pack{} + value;
+}
+
+/**
+ * @brief Select lanes from either pack.
+ * @param mask The mask
+ * @param yes  The lanes where mask is true
+ * @param no   The lanes where mask is false
+ * @return the pack
+ */
+inline Pack select(Mask mask, Pack yes, Pack no)
+{
+    return mask ? yes : no;
+}
+
+/**
+ * @brief Check whether a mask is true in all lanes.
+ * @param mask The mask
+ * @return true if so, else false
+ */
+inline bool all(Mask mask)
+{
+#if defined(__GNUC__)
+    for (std::size_t i = 0; i < SIMD_LANES; ++i)
+    {
+        if (!mask[i])
+        {
+            return false;
+        }
+    }
+    return true;
+#else
+    return mask;
+#endif
+}
+
+/**
+ * @brief Check the sign bits, including those of zeros.
+ * @param pack The pack
+ * @return the mask of negative lanes
+ */
+inline Mask negative(Pack pack)
+{
+#if defined(__GNUC__)
+    Mask bits;
+    std::memcpy(&bits, &pack, sizeof(bits));
+    return bits < 0;
+#else
+    return std::signbit(pack);
+#endif
+}
+
+/**
+ * @brief Round to the nearest integer, ties to even.
+ * @param pack The pack; |x| < 2^51
+ * @return the rounded pack
+ */
+inline Pack round(Pack pack)
+{
+    // adding 1.5 * 2^52 leaves no bits for the fraction
+    return (pack + 6755399441055744.0) - 6755399441055744.0;
+}
+
+/**
+ * @brief Compute the square root.
+ * @param pack The pack; x >= 0
+ * @return the square root
+ */
+inline Pack sqrt(Pack pack)
+{
+#if defined(__GNUC__) && defined(__AVX__)
+    __m256d v;
+    std::memcpy(&v, &pack, sizeof(v));
+    v = _mm256_sqrt_pd(v);
+    std::memcpy(&pack, &v, sizeof(v));
+#elif defined(__GNUC__) && defined(__SSE2__)
+    __m128d v;
+    std::memcpy(&v, &pack, sizeof(v));
+    v = _mm_sqrt_pd(v);
+    std::memcpy(&pack, &v, sizeof(v));
+#elif defined(__GNUC__) && defined(__ARM_NEON) && defined(__aarch64__)
+    float64x2_t v;
+    std::memcpy(&v, &pack, sizeof(v));
+    v = vsqrtq_f64(v);
+    std::memcpy(&pack, &v, sizeof(v));
+#elif defined(__GNUC__)
+    for (std::size_t i = 0; i < SIMD_LANES; ++i)
+    {
+        pack[i] = std::sqrt(pack[i]);
+    }
+#else
+    pack = std::sqrt(pack);
+#endif
+    return pack;
+}
+
+/**
+ * @brief Compute sine and cosine at once.
+ * @param x   The radian; |x| < 2^20
+ * @param sin The sine
+ * @param cos The cosine
+ */
+inline void sincos(Pack x, Pack& sin, Pack& cos)
+{
+    constexpr double S1 = -1.66666666666666324348e-01;
+    constexpr double S2 = 8.33333333332248946124e-03;
+    constexpr double S3 = -1.98412698298579493134e-04;
+    constexpr double S4 = 2.75573137070700676789e-06;
+    constexpr double S5 = -2.50507602534068634195e-08;
+    constexpr double S6 = 1.58969099521155010221e-10;
+    constexpr double C1 = 4.16666666666666019037e-02;
+    constexpr double C2 = -1.38888888888741095749e-03;
+    constexpr double C3 = 2.48015872894767294178e-05;
+    constexpr double C4 = -2.75573143513906633035e-07;
+    constexpr double C5 = 2.08757232129817482790e-09;
+    constexpr double C6 = -1.13596475577881948265e-11;
+
+    // reduce to r in [-pi/4, pi/4], with pi/2 split in two parts for precision
+    const Pack k = round(x * 6.36619772367581382433e-01);
+    const Pack r = (x - k * 1.57079632673412561417e+00) - k * 6.07710050650619224932e-11;
+    const Pack q = k - 4.0 * round((k - 1.5) * 0.25);
+    const Pack z = r * r;
+    const Pack s = r + r * z * (S1 + z * (S2 + z * (S3 + z * (S4 + z * (S5 + z * S6)))));
+    const Pack w = z * z;
+    const Pack c = 1.0 - 0.5 * z + w * (C1 + z * (C2 + z * (C3 + z * (C4 + z * (C5 + z * C6)))));
+    sin          = select(q == 0.0, s, select(q == 1.0, c, select(q == 2.0, -s, -c)));
+    cos          = select(q == 0.0, c, select(q == 1.0, -s, select(q == 2.0, -c, s)));
+}
+
+/**
+ * @brief Compute the arc tangent of y/x, using the signs to determine the quadrant.
+ * @param y The y coordinate
+ * @param x The x coordinate
+ * @return the radian in [-pi, pi]
+ */
+inline Pack atan2(Pack y, Pack x)
+{
+    constexpr double T0  = 3.33333333333329318027e-01;
+    constexpr double T1  = -1.99999999998764832476e-01;
+    constexpr double T2  = 1.42857142725034663711e-01;
+    constexpr double T3  = -1.11111104054623557880e-01;
+    constexpr double T4  = 9.09088713343650656196e-02;
+    constexpr double T5  = -7.69187620504482999495e-02;
+    constexpr double T6  = 6.66107313738753120669e-02;
+    constexpr double T7  = -5.83357013379057348645e-02;
+    constexpr double T8  = 4.97687799461593236017e-02;
+    constexpr double T9  = -3.65315727442169155270e-02;
+    constexpr double T10 = 1.62858201153657823623e-02;
+
+    const Pack ay  = select(negative(y), -y, y);
+    const Pack ax  = select(negative(x), -x, x);
+    const Mask big = ay > ax;
+    const Pack num = select(big, ax, ay);
+    const Pack den = select(big, ay, ax);
+    const Pack a   = select(den > 0.0, num / den, splat(0.0));
+    // reduce a in [0, 1] to t in [-7/16, 7/16], where atan(a) = atan(c) + atan(t)
+    const Mask half = a >= 0.4375;
+    const Mask one  = a >= 0.6875;
+    const Pack t =
+        select(one, (a - 1.0) / (a + 1.0), select(half, (2.0 * a - 1.0) / (2.0 + a), a));
+    const Pack hi = select(one, splat(7.85398163397448278999e-01),
+                           select(half, splat(4.63647609000806093515e-01), splat(0.0)));
+    const Pack lo = select(one, splat(3.06161699786838301793e-17),
+                           select(half, splat(2.26987774529616870924e-17), splat(0.0)));
+    const Pack z  = t * t;
+    const Pack w  = z * z;
+    const Pack s1 = z * (T0 + w * (T2 + w * (T4 + w * (T6 + w * (T8 + w * T10)))));
+    const Pack s2 = w * (T1 + w * (T3 + w * (T5 + w * (T7 + w * T9))));
+    Pack       r  = hi - ((t * (s1 + s2) - lo) - t);
+    r             = select(big, 1.57079632679489655800e+00 - r, r);
+    r             = select(negative(x), 3.14159265358979311600e+00 - r, r);
+    return select(negative(y), -r, r);
+}
+}  // namespace simd
+}  // namespace math
@@ -28,6 +28,7 @@
 #include <string>
 
 #include <boost/optional.hpp>
+#include <boost/utility/string_view.hpp>
 #include <boost/variant.hpp>
 
 namespace util
@@ -40,6 +41,10 @@ using Number = boost::variant<std::int32_t, std::uint64_t, double>;
 /// An optional number, which may be invalid
 using OptNumber = boost::optional<Number>;
 
+/// @typedef StringView
+/// A non-owning view of a string
+using StringView = boost::string_view;
+
 /**
  * @brief Convert a string to number.
  * @tparam T    The number type
@@ -97,6 +102,143 @@ inline std::list<std::string> splitCommaSeparated(const std::string& str)
     return list;
 }
 
+/**
+ * @brief Check whether a character is a decimal digit.
+ * @param c The character
+ * @return true if yes, else false
+ */
+constexpr bool isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+/**
+ * @brief Check whether a character is a whitespace, like in the regex class \s.
+ * @param c The character
+ * @return true if yes, else false
+ */
+constexpr bool isSpace(char c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+/**
+ * @brief Parse a fixed amount of decimal digits in place.
+ * @tparam T The integer type
+ * @param str   The first digit
+ * @param len   The amount of digits
+ * @param value The parsed value
+ * @return true on success, false if any character is not a digit
+ */
+template<typename T>
+inline bool parseDigits(const char* str, std::size_t len, T& value) noexcept
+{
+    T result = 0;
+    for (std::size_t i = 0; i < len; ++i)
+    {
+        if (!isDigit(str[i]))
+        {
+            return false;
+        }
+        result = static_cast<T>(result * 10 + (str[i] - '0'));
+    }
+    value = result;
+    return true;
+}
+
+/**
+ * @brief Parse a fixed amount of hexadecimal digits in place, case insensitive.
+ * @tparam T The integer type
+ * @param str   The first digit
+ * @param len   The amount of digits
+ * @param value The parsed value
+ * @return true on success, false if any character is not a hex digit
+ */
+template<typename T>
+inline bool parseHexDigits(const char* str, std::size_t len, T& value) noexcept
+{
+    T result = 0;
+    for (std::size_t i = 0; i < len; ++i)
+    {
+        std::int32_t digit;
+        if (isDigit(str[i]))
+        {
+            digit = str[i] - '0';
+        }
+        else if (str[i] >= 'A' && str[i] <= 'F')
+        {
+            digit = str[i] - 'A' + 10;
+        }
+        else if (str[i] >= 'a' && str[i] <= 'f')
+        {
+            digit = str[i] - 'a' + 10;
+        }
+        else
+        {
+            return false;
+        }
+        result = static_cast<T>((result << 4) | digit);
+    }
+    value = result;
+    return true;
+}
+
+/**
+ * @brief Parse a decimal number of the form [+-]digits[.digits] in place.
+ *
+ * Unlike std::stod this is independent of the locale and does not accept any leading, or trailing
+ * characters. Up to 15 significant digits the result is identical to std::stod.
+ *
+ * @param str   The string
+ * @param value The parsed value
+ * @return true on success, else false
+ */
+inline bool parseDecimal(StringView str, double& value) noexcept
+{
+    static constexpr double pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                       1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                       1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    std::size_t   i        = 0;
+    bool          negative = false;
+    bool          point    = false;
+    std::uint64_t mantissa = 0;
+    std::size_t   digits   = 0;
+    std::size_t   decimals = 0;
+
+    if (!str.empty() && (str[0] == '-' || str[0] == '+'))
+    {
+        negative = str[0] == '-';
+        ++i;
+    }
+    for (; i < str.size(); ++i)
+    {
+        if (isDigit(str[i]))
+        {
+            if (++digits > 19)
+            {
+                return false;
+            }
+            mantissa = mantissa * 10 + static_cast<std::uint64_t>(str[i] - '0');
+            decimals += point ? 1 : 0;
+        }
+        else if (str[i] == '.' && !point)
+        {
+            point = true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    if (digits == 0)
+    {
+        return false;
+    }
+    value = static_cast<double>(mantissa) / pow10[decimals];
+    value = negative ? -value : value;
+    return true;
+}
+
 /**
  * @brief Get enum value as the underlying type.
  * @param value The enum value
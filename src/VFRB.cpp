@@ -22,11 +22,13 @@
 #include "VFRB.h"
 
 #include <csignal>
+#include <cstdint>
 #include <exception>
 #include <sstream>
 #include <thread>
 
 #include "client/ClientManager.h"
+#include "client/Replay.h"
 #include "client/net/impl/ConnectorImplBoost.h"
 #include "config/Configuration.h"
 #include "data/AircraftData.h"
@@ -37,20 +39,34 @@
 #include "feed/FeedFactory.h"
 #include "object/Atmosphere.h"
 #include "object/GpsPosition.h"
+#include "object/impl/DateTimeImplBoost.h"
+#include "parameters.h"
+#include "server/StatsServer.h"
 #include "util/Logger.hpp"
+#include "util/Metrics.h"
 #include "util/SignalListener.h"
 
 using namespace data;
 
-#define SYNC_TIME 1
-
 VFRB::VFRB(std::shared_ptr<config::Configuration> config)
-    : m_aircraftData(std::make_shared<AircraftData>(config->get_maxDistance())),
+    : m_aircraftData(std::make_shared<AircraftData>(
+          config->get_maxDistance(), AIRCRAFT_DATA_SHARDS, config->get_localRadius())),
       m_atmosphereData(
           std::make_shared<AtmosphereData>(object::Atmosphere(config->get_atmPressure(), 0))),
       m_gpsData(std::make_shared<GpsData>(config->get_position(), config->get_groundMode())),
       m_windData(std::make_shared<WindData>()),
+      m_messagePool(server::MessagePool::create()),
       m_server(config->get_serverPort()),
+      m_replay(config->get_replayFiles().empty() ?
+                   nullptr :
+                   std::make_shared<client::Replay>(config->get_replayFiles(),
+                                                    config->get_replaySpeed())),
+      m_statsPort(config->get_statsPort()),
+      m_aircraftRate(config->get_aircraftRate()),
+      m_gpsRate(config->get_gpsRate()),
+      m_atmosphereRate(config->get_atmosphereRate()),
+      m_windRate(config->get_windRate()),
+      m_emitOnUpdate(config->get_emitOnUpdate()),
       m_running(false)
 {
     createFeeds(config);
@@ -62,12 +78,32 @@ void VFRB::run() noexcept
     logger.info("(VFRB) startup");
     std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
     util::SignalListener                  signals;
-    client::ClientManager                 clientManager;
+    client::ClientManager                 clientManager(C_IO_THREADS, m_replay);
+    std::unique_ptr<server::StatsServer>  stats;
 
     signals.addHandler([this](const boost::system::error_code&, const int) {
         logger.info("(VFRB) caught signal to shutdown ...");
         m_running = false;
+        m_scheduler.notify();
     });
+    // only data served on change, or as soon as updated, needs to wake the server
+    auto notify = [this] { m_scheduler.notify(); };
+    if (m_emitOnUpdate)
+    {
+        m_aircraftData->set_notify(notify);
+    }
+    if (m_gpsRate == 0.0)
+    {
+        m_gpsData->set_notify(notify);
+    }
+    if (m_atmosphereRate == 0.0)
+    {
+        m_atmosphereData->set_notify(notify);
+    }
+    if (m_windRate == 0.0)
+    {
+        m_windData->set_notify(notify);
+    }
     for (auto it : m_feeds)
     {
         logger.info("(VFRB) run feed: ", it->get_name());
@@ -81,6 +117,18 @@ void VFRB::run() noexcept
         }
     }
     m_feeds.clear();
+    if (m_statsPort > 0)
+    {
+        try
+        {
+            stats.reset(new server::StatsServer(m_statsPort));
+            stats->run();
+        }
+        catch (const std::exception& e)
+        {
+            logger.error("(VFRB) failed to serve metrics: ", e.what());
+        }
+    }
 
     signals.run();
     m_server.run();
@@ -89,26 +137,87 @@ void VFRB::run() noexcept
     clientManager.stop();
     m_server.stop();
     signals.stop();
+    for (const auto& it : metrics.summarizeLatencies())
+    {
+        logger.info("(VFRB) latency of ", it);
+    }
     logger.info("Stopped after ", get_duration(start));
 }
 
 void VFRB::serve()
 {
-    std::string message;
-    std::this_thread::sleep_for(std::chrono::seconds(SYNC_TIME));
+    std::string       message;
+    std::string       updated;
+    std::uint64_t     drops      = 0;
+    std::uint64_t     updates    = 0;
+    std::uint64_t     cycles     = 0;
+    const std::size_t aging      = m_scheduler.add(periodOf(1.0));
+    const std::size_t aircrafts  = m_scheduler.add(periodOf(m_aircraftRate));
+    const std::size_t gps        = m_scheduler.add(periodOf(m_gpsRate));
+    const std::size_t atmosphere = m_scheduler.add(periodOf(m_atmosphereRate));
+    const std::size_t wind       = m_scheduler.add(periodOf(m_windRate));
+    util::Gauge&      cycleTime =
+        metrics.gauge("vfrb_serve_cycle_seconds", "Duration of the last serve cycle");
+    // data with a rate of 0 is never due by schedule, but as soon as it changed
+    auto serialize = [&](std::size_t stream, double rate, Data& data) {
+        if (m_scheduler.due(stream) || (rate == 0.0 && data.isUpdated()))
+        {
+            data.get_serialized(message);
+        }
+    };
+
     while (m_running)
     {
+        const bool notified = m_scheduler.wait();
+        if (!m_running)
+        {
+            break;
+        }
+        const auto start = std::chrono::steady_clock::now();
         message.clear();
+        updated.clear();
+        // parsers only need the day to be accurate, so once per cycle is enough
+        object::timestamp::DateTimeImplBoost::refresh();
         try
         {
-            m_aircraftData->processAircrafts(m_gpsData->get_position(),
-                                             m_atmosphereData->get_atmPressure());
-            m_aircraftData->get_serialized(message);
-            m_gpsData->get_serialized(message);
-            m_atmosphereData->get_serialized(message);
-            m_windData->get_serialized(message);
-            m_server.send(message);
-            std::this_thread::sleep_for(std::chrono::seconds(SYNC_TIME));
+            updates += m_gpsData->flush();
+            updates += m_aircraftData->flush();
+            if (m_aircraftData->get_queueDrops() > drops)
+            {
+                logger.warn("(VFRB) aircraft queue full, dropped ",
+                            m_aircraftData->get_queueDrops() - drops, " updates");
+                drops = m_aircraftData->get_queueDrops();
+            }
+            const bool age   = m_scheduler.due(aging);
+            const bool serve = m_scheduler.due(aircrafts);
+            if (age || serve || (m_emitOnUpdate && notified))
+            {
+                m_aircraftData->processAircrafts(m_gpsData->get_position(),
+                                                 m_atmosphereData->get_atmPressure(), age,
+                                                 serve || !m_emitOnUpdate ? nullptr : &updated);
+            }
+            if (serve)
+            {
+                m_aircraftData->get_serialized(message);
+            }
+            message += updated;
+            serialize(gps, m_gpsRate, *m_gpsData);
+            serialize(atmosphere, m_atmosphereRate, *m_atmosphereData);
+            serialize(wind, m_windRate, *m_windData);
+            if (!message.empty())
+            {
+                m_server.send(m_messagePool->seal(message));
+                m_aircraftData->markSent();
+                cycleTime.set(
+                    std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+                        .count());
+                ++cycles;
+            }
+            if (m_replay && m_replay->done())
+            {
+                m_running = false;
+                break;
+            }
         }
         catch (const std::exception& e)
         {
@@ -116,6 +225,28 @@ void VFRB::serve()
             m_running = false;
         }
     }
+    if (m_replay)
+    {
+        double seconds = m_replay->get_seconds();
+        logger.info("(VFRB) replayed ", m_replay->get_lines(), " lines in ", seconds, "s (",
+                    seconds > 0.0 ? m_replay->get_lines() / seconds : 0.0, " lines/s), applied ",
+                    updates, " updates, dropped ", drops, " updates, emitted ", cycles,
+                    " cycles");
+    }
+}
+
+util::Scheduler::Clock::duration VFRB::periodOf(double rate) const
+{
+    if (rate <= 0.0)
+    {
+        return util::Scheduler::Clock::duration::zero();
+    }
+    if (m_replay && m_replay->get_speed() > 0.0)
+    {
+        rate *= m_replay->get_speed();
+    }
+    return std::chrono::duration_cast<util::Scheduler::Clock::duration>(
+        std::chrono::duration<double>(1.0 / rate));
 }
 
 void VFRB::createFeeds(std::shared_ptr<config::Configuration> config)
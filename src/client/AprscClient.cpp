@@ -21,11 +21,13 @@
 
 #include "client/AprscClient.h"
 
+#include <algorithm>
 #include <stdexcept>
 #include <utility>
 
 #include <boost/functional/hash.hpp>
 
+#include "feed/AprscFeed.h"
 #include "util/Logger.hpp"
 
 #ifdef COMPONENT
@@ -39,7 +41,7 @@ using namespace net;
 
 AprscClient::AprscClient(const Endpoint& endpoint, const std::string& login,
                          std::shared_ptr<Connector> connector)
-    : Client(endpoint, COMPONENT, connector), m_login(login + "\r\n")
+    : Client(endpoint, COMPONENT, connector), m_login(login)
 {}
 
 bool AprscClient::equals(const Client& other) const
@@ -62,6 +64,54 @@ std::size_t AprscClient::hash() const
     return seed;
 }
 
+void AprscClient::subscribe(std::shared_ptr<feed::Feed> feed)
+{
+    Client::subscribe(feed);
+    auto aprsc = std::static_pointer_cast<feed::AprscFeed>(feed);
+    if (aprsc->hasFilter())
+    {
+        addFilter([aprsc] { return aprsc->get_filter(); });
+    }
+}
+
+void AprscClient::addFilter(Filter filter)
+{
+    std::lock_guard<std::mutex> lk(m_mutex);
+    if (!m_filters.empty())
+    {
+        logger.info(m_component, " combine filters of feeds sharing ", m_endpoint.host, ":",
+                    m_endpoint.port);
+    }
+    m_filters.push_back(std::move(filter));
+}
+
+std::string AprscClient::get_filter() const
+{
+    std::lock_guard<std::mutex> lk(m_mutex);
+    return combineFilters();
+}
+
+std::string AprscClient::combineFilters() const
+{
+    static const std::string command("filter");
+
+    std::string terms;
+    for (const auto& it : m_filters)
+    {
+        std::string filter = it();
+        if (filter.compare(0, command.length(), command) == 0)
+        {
+            filter.erase(0, command.length());
+        }
+        if (!filter.empty() && filter.front() != ' ')
+        {
+            terms += ' ';
+        }
+        terms += filter;
+    }
+    return terms.empty() ? terms : command + terms;
+}
+
 void AprscClient::handleConnect(ErrorCode error)
 {
     std::lock_guard<std::mutex> lk(m_mutex);
@@ -69,7 +119,10 @@ void AprscClient::handleConnect(ErrorCode error)
     {
         if (error == ErrorCode::SUCCESS)
         {
-            m_connector->onWrite(m_login,
+            m_sentFilter = combineFilters();
+            m_message    = m_sentFilter.empty() ? m_login : m_login + " " + m_sentFilter;
+            m_message += "\r\n";
+            m_connector->onWrite(m_message,
                                  std::bind(&AprscClient::handleLogin, this, std::placeholders::_1));
         }
         else
@@ -84,7 +137,14 @@ void AprscClient::handleConnect(ErrorCode error)
 void AprscClient::sendKeepAlive()
 {
     m_connector->onTimeout(
-        std::bind(&AprscClient::handleSendKeepAlive, this, std::placeholders::_1), AC_BEACON_INT);
+        std::bind(&AprscClient::handleSendKeepAlive, this, std::placeholders::_1),
+        get_interval());
+}
+
+std::uint32_t AprscClient::get_interval() const
+{
+    return m_filters.empty() ? AC_BEACON_INT :
+                               std::min<std::uint32_t>(AC_FILTER_INT, AC_BEACON_INT);
 }
 
 void AprscClient::handleLogin(ErrorCode error)
@@ -95,6 +155,7 @@ void AprscClient::handleLogin(ErrorCode error)
         if (error == ErrorCode::SUCCESS)
         {
             m_state = State::RUNNING;
+            m_idle  = 0;
             logger.info(m_component, " connected to ", m_endpoint.host, ":", m_endpoint.port);
             sendKeepAlive();
             read();
@@ -114,17 +175,37 @@ void AprscClient::handleSendKeepAlive(ErrorCode error)
     {
         if (error == ErrorCode::SUCCESS)
         {
-            m_connector->onWrite("#keep-alive beacon\r\n", [this](ErrorCode error) {
-                std::lock_guard<std::mutex> lk(m_mutex);
-                if (m_state == State::RUNNING)
+            m_idle += get_interval();
+            m_message.clear();
+            if (!m_filters.empty())
+            {
+                std::string filter = combineFilters();
+                if (filter != m_sentFilter)
                 {
-                    if (error != ErrorCode::SUCCESS)
+                    logger.info(m_component, " refresh ", filter);
+                    m_sentFilter = std::move(filter);
+                    m_message    = "#" + m_sentFilter + "\r\n";
+                }
+            }
+            if (m_message.empty() && m_idle >= AC_BEACON_INT)
+            {
+                m_message = "#keep-alive beacon\r\n";
+            }
+            if (!m_message.empty())
+            {
+                m_idle = 0;
+                m_connector->onWrite(m_message, [this](ErrorCode error) {
+                    std::lock_guard<std::mutex> lk(m_mutex);
+                    if (m_state == State::RUNNING)
                     {
-                        logger.error(m_component, " send keep-alive beacon failed");
-                        reconnect();
+                        if (error != ErrorCode::SUCCESS)
+                        {
+                            logger.error(m_component, " send keep-alive beacon or filter failed");
+                            reconnect();
+                        }
                     }
-                }
-            });
+                });
+            }
             sendKeepAlive();
         }
         else
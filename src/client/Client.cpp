@@ -29,6 +29,7 @@
 
 #include "feed/Feed.h"
 #include "util/Logger.hpp"
+#include "util/Metrics.h"
 
 namespace client
 {
@@ -41,16 +42,24 @@ Client::Client(const Endpoint& endpoint, const char* component,
 
 void Client::run()
 {
-    std::unique_lock<std::mutex> lk(m_mutex);
-    if (m_state == State::NONE)
+    if (start())
     {
-        connect();
-        lk.unlock();
         m_connector->run();
         m_state = State::NONE;
     }
 }
 
+bool Client::start()
+{
+    std::lock_guard<std::mutex> lk(m_mutex);
+    if (m_state != State::NONE)
+    {
+        return false;
+    }
+    connect();
+    return true;
+}
+
 bool Client::equals(const Client& other) const
 {
     return this->m_endpoint == other.m_endpoint;
@@ -83,6 +92,10 @@ void Client::reconnect()
     {
         m_state = State::CONNECTING;
         logger.info(m_component, " schedule reconnect to ", m_endpoint.host, ":", m_endpoint.port);
+        for (auto& it : m_feeds)
+        {
+            it->get_metrics().reconnects.add();
+        }
         m_connector->close();
         timedConnect();
     }
@@ -134,16 +147,26 @@ void Client::handleTimedConnect(ErrorCode error)
     }
 }
 
-void Client::handleRead(ErrorCode error, const std::string& response)
+void Client::handleRead(ErrorCode error, const Lines& lines)
 {
+    // the connector calls back as soon as lines are complete, so this is their receive time
+    const auto                  received = std::chrono::steady_clock::now();
     std::lock_guard<std::mutex> lk(m_mutex);
     if (m_state == State::RUNNING)
     {
         if (error == ErrorCode::SUCCESS)
         {
+            std::size_t bytes = 0;
+            for (const auto& it : lines)
+            {
+                bytes += it.size();
+            }
             for (auto& it : m_feeds)
             {
-                if (!it->process(response))
+                it->get_metrics().bytesRead.add(bytes);
+                it->get_metrics().linesRead.add(lines.size());
+                it->set_received(received);
+                if (!it->processBatch(lines))
                 {
                     stop();
                 }
@@ -23,9 +23,12 @@
 
 #include "client/AprscClient.h"
 #include "client/GpsdClient.h"
+#include "client/Replay.h"
 #include "client/SbsClient.h"
 #include "client/SensorClient.h"
 #include "client/net/impl/ConnectorImplBoost.h"
+#include "client/net/impl/ConnectorImplReplay.h"
+#include "client/net/impl/IoServicePool.h"
 #include "feed/AprscFeed.h"
 #include "feed/Feed.h"
 
@@ -35,43 +38,65 @@ using namespace net;
 
 template<>
 std::shared_ptr<AprscClient>
-    ClientFactory::makeClient<AprscClient>(std::shared_ptr<feed::Feed> feed)
+    ClientFactory::makeClient<AprscClient>(std::shared_ptr<feed::Feed> feed,
+                                           const Endpoint&             endpoint,
+                                           std::shared_ptr<Connector>  connector)
 {
     return std::make_shared<AprscClient>(
-        feed->get_endpoint(), std::static_pointer_cast<feed::AprscFeed>(feed)->get_login(),
-        std::make_shared<ConnectorImplBoost>());
+        endpoint, std::static_pointer_cast<feed::AprscFeed>(feed)->get_login(), connector);
 }
 
 template<>
-std::shared_ptr<SbsClient> ClientFactory::makeClient<SbsClient>(std::shared_ptr<feed::Feed> feed)
+std::shared_ptr<SbsClient> ClientFactory::makeClient<SbsClient>(std::shared_ptr<feed::Feed>,
+                                                                const Endpoint&            endpoint,
+                                                                std::shared_ptr<Connector> connector)
 {
-    return std::make_shared<SbsClient>(feed->get_endpoint(),
-                                       std::make_shared<ConnectorImplBoost>());
+    return std::make_shared<SbsClient>(endpoint, connector);
 }
 
 template<>
 std::shared_ptr<SensorClient>
-    ClientFactory::makeClient<SensorClient>(std::shared_ptr<feed::Feed> feed)
+    ClientFactory::makeClient<SensorClient>(std::shared_ptr<feed::Feed>, const Endpoint& endpoint,
+                                            std::shared_ptr<Connector> connector)
 {
-    return std::make_shared<SensorClient>(feed->get_endpoint(),
-                                          std::make_shared<ConnectorImplBoost>());
+    return std::make_shared<SensorClient>(endpoint, connector);
 }
 
 template<>
-std::shared_ptr<GpsdClient> ClientFactory::makeClient<GpsdClient>(std::shared_ptr<feed::Feed> feed)
+std::shared_ptr<GpsdClient>
+    ClientFactory::makeClient<GpsdClient>(std::shared_ptr<feed::Feed>, const Endpoint& endpoint,
+                                          std::shared_ptr<Connector> connector)
 {
-    return std::make_shared<GpsdClient>(feed->get_endpoint(),
-                                        std::make_shared<ConnectorImplBoost>());
+    return std::make_shared<GpsdClient>(endpoint, connector);
 }
 
-std::shared_ptr<Client> ClientFactory::createClientFor(std::shared_ptr<feed::Feed> feed)
+std::shared_ptr<Client> ClientFactory::createClientFor(std::shared_ptr<feed::Feed>    feed,
+                                                       std::shared_ptr<IoServicePool> pool,
+                                                       std::shared_ptr<Replay>        replay)
 {
+    // a replayed feed connects to its recording, feeds sharing a recording share the client
+    const Endpoint endpoint = replay ? Endpoint{replay->fileOf(feed->get_name()), REPLAY_PORT} :
+                                       feed->get_endpoint();
+    std::shared_ptr<Connector> connector;
+    if (replay)
+    {
+        connector = std::make_shared<ConnectorImplReplay>(replay);
+    }
+    else if (pool)
+    {
+        connector = std::make_shared<ConnectorImplBoost>(pool);
+    }
+    else
+    {
+        connector = std::make_shared<ConnectorImplBoost>();
+    }
     switch (feed->get_protocol())
     {
-        case feed::Feed::Protocol::APRS: return makeClient<AprscClient>(feed);
-        case feed::Feed::Protocol::SBS: return makeClient<SbsClient>(feed);
-        case feed::Feed::Protocol::GPS: return makeClient<GpsdClient>(feed);
-        case feed::Feed::Protocol::SENSOR: return makeClient<SensorClient>(feed);
+        case feed::Feed::Protocol::APRS: return makeClient<AprscClient>(feed, endpoint, connector);
+        case feed::Feed::Protocol::SBS: return makeClient<SbsClient>(feed, endpoint, connector);
+        case feed::Feed::Protocol::GPS: return makeClient<GpsdClient>(feed, endpoint, connector);
+        case feed::Feed::Protocol::SENSOR:
+            return makeClient<SensorClient>(feed, endpoint, connector);
     }
     throw std::logic_error("unknown protocol");  // can never happen
 }
@@ -22,10 +22,19 @@
 #include "client/ClientManager.h"
 
 #include "client/ClientFactory.h"
+#include "client/net/impl/IoServicePool.h"
 #include "feed/Feed.h"
 
 namespace client
 {
+using namespace net;
+
+ClientManager::ClientManager(std::size_t threads, std::shared_ptr<Replay> replay)
+    // replaying connectors run their own IO-service
+    : m_pool(threads > 0 && !replay ? std::make_shared<IoServicePool>(threads) : nullptr),
+      m_replay(replay)
+{}
+
 ClientManager::~ClientManager() noexcept
 {
     stop();
@@ -34,8 +43,8 @@ ClientManager::~ClientManager() noexcept
 void ClientManager::subscribe(std::shared_ptr<feed::Feed> feed)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
-    ClientIter                  it = m_clients.end();
-    it                             = m_clients.insert(ClientFactory::createClientFor(feed)).first;
+    ClientIter                  it =
+        m_clients.insert(ClientFactory::createClientFor(feed, m_pool, m_replay)).first;
     if (it != m_clients.end())
     {
         (*it)->subscribe(feed);
@@ -49,6 +58,15 @@ void ClientManager::subscribe(std::shared_ptr<feed::Feed> feed)
 void ClientManager::run()
 {
     std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_pool)
+    {
+        for (auto it : m_clients)
+        {
+            it->start();
+        }
+        m_pool->run();
+        return;
+    }
     for (auto it : m_clients)
     {
         m_thdGroup.create_thread([this, it] {
@@ -68,6 +86,10 @@ void ClientManager::stop()
             it->scheduleStop();
         }
     }
+    if (m_pool)
+    {
+        m_pool->stop();
+    }
     m_thdGroup.join_all();
 }
 }  // namespace client
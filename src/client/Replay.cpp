@@ -0,0 +1,78 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include "client/Replay.h"
+
+#include <stdexcept>
+
+namespace client
+{
+Replay::Replay(const std::unordered_map<std::string, std::string>& files, double speed)
+    : m_files(files), m_speed(speed > 0.0 ? speed : 0.0), m_pending(0), m_lines(0)
+{}
+
+const std::string& Replay::fileOf(const std::string& feed) const
+{
+    const auto it = m_files.find(feed);
+    if (it == m_files.end())
+    {
+        throw std::logic_error("no recording to replay for " + feed);
+    }
+    return it->second;
+}
+
+void Replay::enroll()
+{
+    ++m_pending;
+}
+
+void Replay::begin()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_begun)
+    {
+        m_begun = true;
+        m_begin = std::chrono::steady_clock::now();
+    }
+}
+
+void Replay::end(std::uint64_t lines)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_lines += lines;
+    if (m_begun)
+    {
+        m_end = std::chrono::steady_clock::now();
+    }
+    --m_pending;
+}
+
+bool Replay::done() const
+{
+    return m_pending == 0;
+}
+
+double Replay::get_seconds() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_begun ? std::chrono::duration<double>(m_end - m_begin).count() : 0.0;
+}
+}  // namespace client
@@ -21,11 +21,15 @@
 
 #include "client/net/impl/ConnectorImplBoost.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include <boost/bind.hpp>
 #include <boost/date_time.hpp>
 #include <boost/move/move.hpp>
 
 #include "client/net/Endpoint.hpp"
+#include "client/net/impl/IoServicePool.h"
 #include "util/Logger.hpp"
 
 namespace client
@@ -39,11 +43,24 @@ ErrorCode evalErrorCode(boost::system::error_code const& error)
 
 ConnectorImplBoost::ConnectorImplBoost()
     : Connector(),
-      m_ioService(),
+      m_ownIoService(new boost::asio::io_service()),
+      m_ioService(*m_ownIoService),
+      m_strand(m_ioService),
       m_socket(m_ioService),
       m_resolver(m_ioService),
       m_timer(m_ioService),
-      m_istream(&m_buffer)
+      m_buffer(C_READ_BUFFER_SIZE)
+{}
+
+ConnectorImplBoost::ConnectorImplBoost(std::shared_ptr<IoServicePool> pool)
+    : Connector(),
+      m_pool(pool),
+      m_ioService(m_pool->get()),
+      m_strand(m_ioService),
+      m_socket(m_ioService),
+      m_resolver(m_ioService),
+      m_timer(m_ioService),
+      m_buffer(C_READ_BUFFER_SIZE)
 {}
 
 void ConnectorImplBoost::run()
@@ -53,6 +70,11 @@ void ConnectorImplBoost::run()
 
 void ConnectorImplBoost::stop()
 {
+    if (m_pool)
+    {
+        m_strand.dispatch([this] { close(); });
+        return;
+    }
     close();
     if (!m_ioService.stopped())
     {
@@ -62,6 +84,8 @@ void ConnectorImplBoost::stop()
 
 void ConnectorImplBoost::close()
 {
+    m_bufferSize = 0;
+    m_lineStart  = 0;
     m_timer.expires_at(boost::posix_time::pos_infin);
     m_timer.cancel();
     if (m_socket.is_open())
@@ -76,20 +100,39 @@ void ConnectorImplBoost::onConnect(const Endpoint& endpoint, const Callback& cal
 {
     boost::asio::ip::tcp::resolver::query query(
         endpoint.host, endpoint.port, boost::asio::ip::tcp::resolver::query::canonical_name);
-    m_resolver.async_resolve(query, boost::bind(&ConnectorImplBoost::handleResolve, this,
-                                                boost::asio::placeholders::error,
-                                                boost::asio::placeholders::iterator, callback));
+    m_resolver.async_resolve(
+        query, m_strand.wrap(boost::bind(&ConnectorImplBoost::handleResolve, this,
+                                         boost::asio::placeholders::error,
+                                         boost::asio::placeholders::iterator, callback)));
 }
 
 void ConnectorImplBoost::onRead(const ReadCallback& callback)
 {
     if (m_socket.is_open())
     {
-        boost::asio::async_read_until(
-            m_socket, m_buffer, "\r\n",
-            boost::bind(&ConnectorImplBoost::handleRead, this, boost::asio::placeholders::error,
-                        boost::asio::placeholders::bytes_transferred, callback));
+        // lines passed before are consumed, keep only the incomplete rest
+        if (m_lineStart > 0)
+        {
+            m_bufferSize -= m_lineStart;
+            std::memmove(m_buffer.data(), m_buffer.data() + m_lineStart, m_bufferSize);
+            m_lineStart = 0;
+        }
+        readChunk(callback);
+    }
+}
+
+void ConnectorImplBoost::readChunk(const ReadCallback& callback)
+{
+    if (m_bufferSize == m_buffer.size())
+    {
+        logger.debug("(Client) discard line exceeding ", m_buffer.size(), " bytes");
+        m_bufferSize = 0;
     }
+    m_socket.async_read_some(
+        boost::asio::buffer(m_buffer.data() + m_bufferSize, m_buffer.size() - m_bufferSize),
+        m_strand.wrap(boost::bind(&ConnectorImplBoost::handleRead, this,
+                                  boost::asio::placeholders::error,
+                                  boost::asio::placeholders::bytes_transferred, callback)));
 }
 
 void ConnectorImplBoost::onWrite(const std::string& msg, const Callback& callback)
@@ -98,8 +141,9 @@ void ConnectorImplBoost::onWrite(const std::string& msg, const Callback& callbac
     {
         boost::asio::async_write(
             m_socket, boost::asio::buffer(msg),
-            boost::bind(&ConnectorImplBoost::handleWrite, this, boost::asio::placeholders::error,
-                        boost::asio::placeholders::bytes_transferred, callback));
+            m_strand.wrap(boost::bind(&ConnectorImplBoost::handleWrite, this,
+                                      boost::asio::placeholders::error,
+                                      boost::asio::placeholders::bytes_transferred, callback)));
     }
 }
 
@@ -109,8 +153,8 @@ void ConnectorImplBoost::onTimeout(const Callback& callback, std::uint32_t timeo
     {
         resetTimer(timeout);
     }
-    m_timer.async_wait(boost::bind(&ConnectorImplBoost::handleTimeout, this,
-                                   boost::asio::placeholders::error, callback));
+    m_timer.async_wait(m_strand.wrap(boost::bind(&ConnectorImplBoost::handleTimeout, this,
+                                                 boost::asio::placeholders::error, callback)));
 }
 
 void ConnectorImplBoost::resetTimer(std::uint32_t vTimeout)
@@ -141,10 +185,11 @@ void ConnectorImplBoost::handleResolve(const boost::system::error_code&
     ErrorCode const ec = evalErrorCode(error);
     if (ec == ErrorCode::SUCCESS)
     {
-        boost::asio::async_connect(m_socket, resolverIt,
-                                   boost::bind(&ConnectorImplBoost::handleConnect, this,
-                                               boost::asio::placeholders::error,
-                                               boost::asio::placeholders::iterator, callback));
+        boost::asio::async_connect(
+            m_socket, resolverIt,
+            m_strand.wrap(boost::bind(&ConnectorImplBoost::handleConnect, this,
+                                      boost::asio::placeholders::error,
+                                      boost::asio::placeholders::iterator, callback)));
     }
     else
     {
@@ -180,19 +225,38 @@ void ConnectorImplBoost::handleTimeout(const boost::system::error_code& error,
     callback(ec);
 }
 
-void ConnectorImplBoost::handleRead(const boost::system::error_code& error, std::size_t,
+void ConnectorImplBoost::handleRead(const boost::system::error_code& error, std::size_t bytes,
                                     const ReadCallback&              callback) noexcept
 {
     ErrorCode const ec = evalErrorCode(error);
-    if (ec == ErrorCode::SUCCESS)
+    m_lines.clear();
+    if (ec != ErrorCode::SUCCESS)
     {
-        std::getline(m_istream, m_response);
-        m_response.append("\n");
+        logger.debug("(Client) read: ", error.message());
+        callback(ec, m_lines);
+        return;
+    }
+    // only the new bytes, and a '\r' right before them, can complete a line
+    const char* const data = m_buffer.data();
+    std::size_t       pos  = std::max(m_lineStart, m_bufferSize > 0 ? m_bufferSize - 1 : 0);
+    m_bufferSize += bytes;
+    const void* found;
+    while ((found = std::memchr(data + pos, '\n', m_bufferSize - pos)) != nullptr)
+    {
+        pos = static_cast<const char*>(found) - data + 1;
+        if (pos - m_lineStart >= 2 && data[pos - 2] == '\r')
+        {
+            m_lines.emplace_back(data + m_lineStart, pos - m_lineStart);
+            m_lineStart = pos;
+        }
+    }
+    if (m_lines.empty())
+    {
+        readChunk(callback);
     }
     else
     {
-        logger.debug("(Client) read: ", error.message());
+        callback(ec, m_lines);
     }
-    callback(ec, m_response);
 }
 }  // namespace client
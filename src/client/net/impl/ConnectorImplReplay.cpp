@@ -0,0 +1,225 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include "client/net/impl/ConnectorImplReplay.h"
+
+#include <cctype>
+#include <cstdlib>
+
+#include <boost/date_time.hpp>
+
+#include "client/Replay.h"
+#include "client/net/Endpoint.hpp"
+#include "util/Logger.hpp"
+
+namespace client
+{
+using namespace net;
+
+ConnectorImplReplay::ConnectorImplReplay(std::shared_ptr<Replay> replay)
+    : Connector(), m_replay(replay), m_timer(m_ioService), m_pacer(m_ioService)
+{
+    m_replay->enroll();
+}
+
+ConnectorImplReplay::~ConnectorImplReplay() noexcept
+{
+    finish();
+}
+
+void ConnectorImplReplay::run()
+{
+    m_ioService.run();
+}
+
+void ConnectorImplReplay::stop()
+{
+    close();
+    if (!m_ioService.stopped())
+    {
+        m_ioService.stop();
+    }
+}
+
+void ConnectorImplReplay::close()
+{
+    m_timer.expires_at(boost::posix_time::pos_infin);
+    m_timer.cancel();
+    m_pacer.cancel();
+    if (m_file.is_open())
+    {
+        m_file.close();
+    }
+}
+
+void ConnectorImplReplay::onConnect(const Endpoint& endpoint, const Callback& callback)
+{
+    const std::string file = endpoint.host;
+    m_ioService.post([this, file, callback] {
+        m_file.open(file);
+        if (!m_file)
+        {
+            logger.error("(Client) failed to open recording ", file);
+            finish();
+            m_ioService.stop();
+            return;
+        }
+        m_start = std::chrono::steady_clock::now();
+        m_replay->begin();
+        callback(ErrorCode::SUCCESS);
+    });
+}
+
+void ConnectorImplReplay::onRead(const ReadCallback& callback)
+{
+    if (m_file.is_open())
+    {
+        m_ioService.post([this, callback] { readBatch(callback); });
+    }
+}
+
+void ConnectorImplReplay::onWrite(const std::string&, const Callback& callback)
+{
+    m_ioService.post([callback] { callback(ErrorCode::SUCCESS); });
+}
+
+void ConnectorImplReplay::onTimeout(const Callback& callback, std::uint32_t timeout)
+{
+    if (timeout > 0)
+    {
+        resetTimer(timeout);
+    }
+    m_timer.async_wait([callback](const boost::system::error_code& error) {
+        callback(!error ? ErrorCode::SUCCESS : ErrorCode::FAILURE);
+    });
+}
+
+void ConnectorImplReplay::resetTimer(std::uint32_t timeout)
+{
+    m_timer.expires_from_now(boost::posix_time::seconds(timeout));
+}
+
+bool ConnectorImplReplay::timerExpired()
+{
+    return m_timer.expires_at() <= boost::asio::deadline_timer::traits_type::now();
+}
+
+void ConnectorImplReplay::readBatch(const ReadCallback& callback)
+{
+    const auto now = std::chrono::steady_clock::now();
+    m_batch.clear();
+    m_ends.clear();
+    while (m_batch.size() < C_READ_BUFFER_SIZE && (m_hasLine || nextLine()) && dueTime() <= now)
+    {
+        m_batch.append(m_line).append("\r\n");
+        m_ends.push_back(m_batch.size());
+        m_hasLine = false;
+    }
+    if (!m_ends.empty())
+    {
+        std::size_t begin = 0;
+        m_lines.clear();
+        for (auto end : m_ends)
+        {
+            m_lines.emplace_back(m_batch.data() + begin, end - begin);
+            begin = end;
+        }
+        m_replayed += m_lines.size();
+        callback(ErrorCode::SUCCESS, m_lines);
+    }
+    else if (m_hasLine)
+    {
+        m_pacer.expires_at(dueTime());
+        m_pacer.async_wait([this, callback](const boost::system::error_code& error) {
+            if (!error)
+            {
+                readBatch(callback);
+            }
+        });
+    }
+    else
+    {
+        logger.info("(Client) replayed ", m_replayed, " lines");
+        finish();
+        m_ioService.stop();
+    }
+}
+
+bool ConnectorImplReplay::nextLine()
+{
+    while (std::getline(m_file, m_line))
+    {
+        if (!m_line.empty() && m_line.back() == '\r')
+        {
+            m_line.pop_back();
+        }
+        // an optional receive time, like "1508245321.123 "
+        std::size_t pos = 0;
+        while (pos < m_line.size() && std::isdigit(static_cast<unsigned char>(m_line[pos])))
+        {
+            ++pos;
+        }
+        if (pos > 0 && pos < m_line.size() && m_line[pos] == '.')
+        {
+            ++pos;
+            while (pos < m_line.size() && std::isdigit(static_cast<unsigned char>(m_line[pos])))
+            {
+                ++pos;
+            }
+        }
+        if (pos > 0 && pos < m_line.size() && (m_line[pos] == ' ' || m_line[pos] == '\t'))
+        {
+            m_lineTime = std::strtod(m_line.c_str(), nullptr);
+            if (m_firstTime < 0.0)
+            {
+                m_firstTime = m_lineTime;
+            }
+            m_line.erase(0, pos + 1);
+        }
+        if (!m_line.empty())
+        {
+            m_hasLine = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::chrono::steady_clock::time_point ConnectorImplReplay::dueTime() const
+{
+    if (m_replay->get_speed() <= 0.0 || m_firstTime < 0.0)
+    {
+        return m_start;
+    }
+    return m_start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                         std::chrono::duration<double>((m_lineTime - m_firstTime) /
+                                                       m_replay->get_speed()));
+}
+
+void ConnectorImplReplay::finish()
+{
+    if (!m_finished)
+    {
+        m_finished = true;
+        m_replay->end(m_replayed);
+    }
+}
+}  // namespace client
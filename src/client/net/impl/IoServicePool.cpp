@@ -0,0 +1,85 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include "client/net/impl/IoServicePool.h"
+
+#include <algorithm>
+
+#include "util/Logger.hpp"
+
+namespace client
+{
+using namespace net;
+
+IoServicePool::IoServicePool(std::size_t threads)
+    : m_ioService(static_cast<int>(std::max<std::size_t>(threads, 1))),
+      m_size(std::max<std::size_t>(threads, 1))
+{}
+
+IoServicePool::~IoServicePool() noexcept
+{
+    stop();
+}
+
+void IoServicePool::run()
+{
+    if (!m_threads.empty())
+    {
+        return;
+    }
+    m_work.reset(new boost::asio::io_service::work(m_ioService));
+    for (std::size_t i = 0; i < m_size; ++i)
+    {
+        m_threads.push_back(std::thread([this] {
+            try
+            {
+                m_ioService.run();
+            }
+            catch (const std::exception& e)
+            {
+                logger.error("(IoServicePool) run: ", e.what());
+            }
+        }));
+    }
+}
+
+void IoServicePool::stop()
+{
+    m_work.reset();
+    if (!m_ioService.stopped())
+    {
+        m_ioService.stop();
+    }
+    for (auto& it : m_threads)
+    {
+        if (it.joinable())
+        {
+            it.join();
+        }
+    }
+    m_threads.clear();
+}
+
+boost::asio::io_service& IoServicePool::get()
+{
+    return m_ioService;
+}
+}  // namespace client
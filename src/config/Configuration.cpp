@@ -21,6 +21,7 @@
 
 #include "config/Configuration.h"
 
+#include <algorithm>
 #include <limits>
 #include <stdexcept>
 #include <utility>
@@ -43,11 +44,18 @@ Configuration::Configuration(std::istream& stream)
         m_atmPressure         = boost::get<double>(
             checkNumber(stringToNumber<double>(properties.get_property(PATH_PRESSURE, "1013.25")),
                         PATH_PRESSURE));
-        m_position    = resolvePosition(properties);
-        m_maxDistance = resolveFilter(properties, KV_KEY_MAX_DIST);
-        m_maxHeight   = resolveFilter(properties, KV_KEY_MAX_HEIGHT);
-        m_serverPort  = resolveServerPort(properties);
-        m_groundMode  = !properties.get_property(PATH_GND_MODE).empty();
+        m_position       = resolvePosition(properties);
+        m_maxDistance    = resolveFilter(properties, KV_KEY_MAX_DIST);
+        m_maxHeight      = resolveFilter(properties, KV_KEY_MAX_HEIGHT);
+        m_serverPort     = resolvePort(properties, PATH_SERVER_PORT, 4353);
+        m_statsPort      = resolvePort(properties, PATH_STATS_PORT, 0);
+        m_localRadius    = resolveLocalRadius(properties);
+        m_aircraftRate   = resolveRate(properties, PATH_AIRCRAFT_RATE, false);
+        m_gpsRate        = resolveRate(properties, PATH_GPS_RATE, true);
+        m_atmosphereRate = resolveRate(properties, PATH_ATMOS_RATE, true);
+        m_windRate       = resolveRate(properties, PATH_WIND_RATE, true);
+        m_emitOnUpdate   = !properties.get_property(PATH_EMIT_ON_UPDATE).empty();
+        m_groundMode     = !properties.get_property(PATH_GND_MODE).empty();
         resolveFeeds(properties);
         dumpInfo();
     }
@@ -72,13 +80,15 @@ object::GpsPosition Configuration::resolvePosition(const Properties& properties)
     return object::GpsPosition(pos, geoid);
 }
 
-std::uint16_t Configuration::resolveServerPort(const Properties& properties) const
+std::uint16_t Configuration::resolvePort(const Properties& properties, const char* path,
+                                         std::uint16_t fallback) const
 {
     try
     {
         std::uint64_t port = boost::get<std::uint64_t>(checkNumber(
-            stringToNumber<std::uint64_t>(properties.get_property(PATH_SERVER_PORT, "4353")),
-            PATH_SERVER_PORT));
+            stringToNumber<std::uint64_t>(
+                properties.get_property(path, std::to_string(fallback))),
+            path));
         if (port > std::numeric_limits<std::uint16_t>::max())
         {
             throw std::invalid_argument("");
@@ -87,7 +97,7 @@ std::uint16_t Configuration::resolveServerPort(const Properties& properties) con
     }
     catch (const std::logic_error&)
     {
-        return 4353;
+        return fallback;
     }
 }
 
@@ -107,6 +117,40 @@ std::int32_t Configuration::resolveFilter(const Properties&  properties,
     }
 }
 
+std::int32_t Configuration::resolveLocalRadius(const Properties& properties) const
+{
+    try
+    {
+        std::int32_t radius = boost::get<std::int32_t>(checkNumber(
+            stringToNumber<std::int32_t>(properties.get_property(PATH_LOCAL_RADIUS, "0")),
+            PATH_LOCAL_RADIUS));
+        return radius < 0 ? 0 : radius;
+    }
+    catch (const std::invalid_argument&)
+    {
+        return 0;
+    }
+}
+
+double Configuration::resolveRate(const Properties& properties, const char* path,
+                                  bool onChange) const
+{
+    try
+    {
+        double rate = boost::get<double>(
+            checkNumber(stringToNumber<double>(properties.get_property(path, "1")), path));
+        if (rate < 0.0 || (rate == 0.0 && !onChange))
+        {
+            throw std::invalid_argument("");
+        }
+        return std::min(rate, 50.0);
+    }
+    catch (const std::invalid_argument&)
+    {
+        return 1.0;
+    }
+}
+
 void Configuration::resolveFeeds(const Properties& properties)
 {
     for (auto& it : splitCommaSeparated(properties.get_property(PATH_FEEDS)))
@@ -143,6 +187,13 @@ void Configuration::dumpInfo() const
     logger.info("(Config) ", PATH_MAX_HEIGHT, ": ", m_maxHeight);
     logger.info("(Config) ", PATH_MAX_DIST, ": ", m_maxDistance);
     logger.info("(Config) ", PATH_SERVER_PORT, ": ", m_serverPort);
+    logger.info("(Config) ", PATH_STATS_PORT, ": ", m_statsPort);
+    logger.info("(Config) ", PATH_LOCAL_RADIUS, ": ", m_localRadius);
+    logger.info("(Config) ", PATH_AIRCRAFT_RATE, ": ", m_aircraftRate);
+    logger.info("(Config) ", PATH_GPS_RATE, ": ", m_gpsRate);
+    logger.info("(Config) ", PATH_ATMOS_RATE, ": ", m_atmosphereRate);
+    logger.info("(Config) ", PATH_WIND_RATE, ": ", m_windRate);
+    logger.info("(Config) ", PATH_EMIT_ON_UPDATE, ": ", m_emitOnUpdate ? "Yes" : "No");
     logger.info("(Config) ", PATH_GND_MODE, ": ", m_groundMode ? "Yes" : "No");
     logger.info("(Config) number of feeds: ", m_feedProperties.size());
 }
@@ -21,9 +21,11 @@
 
 #include "data/AircraftData.h"
 
-#include <iterator>
+#include <chrono>
 #include <stdexcept>
 
+#include "util/Metrics.h"
+
 #include "parameters.h"
 
 #ifndef ESTIMATED_TRAFFIC
@@ -32,87 +34,278 @@
 #    define ESTIMATED_TRAFFIC 1
 #endif
 
+#ifndef AIRCRAFT_DATA_SHARDS
+/// @def AIRCRAFT_DATA_SHARDS
+/// Amount of partitions of the aircraft store
+#    define AIRCRAFT_DATA_SHARDS 1
+#endif
+
+#ifndef AIRCRAFT_INGEST_QUEUE_SIZE
+/// @def AIRCRAFT_INGEST_QUEUE_SIZE
+/// Capacity of the ingest queue
+#    define AIRCRAFT_INGEST_QUEUE_SIZE 1024
+#endif
+
+static_assert(AC_DELETE_THRESHOLD <= 255, "the update age of a record is 8-bit");
+
 using namespace object;
 
 namespace data
 {
 AircraftData::AircraftData() : AircraftData(0) {}
 
-AircraftData::AircraftData(std::int32_t maxDist) : Data(), m_processor(maxDist)
+AircraftData::AircraftData(std::int32_t maxDist) : AircraftData(maxDist, AIRCRAFT_DATA_SHARDS) {}
+
+AircraftData::AircraftData(std::int32_t maxDist, std::size_t shards, std::int32_t localRadius)
+    : Data(),
+      m_processor(maxDist, localRadius),
+      m_grid(maxDist, AIRCRAFT_CULLING_MARGIN),
+      m_shards(shards > 0 ? shards : 1),
+      m_queue(AIRCRAFT_INGEST_QUEUE_SIZE),
+      m_tracked(metrics.gauge("vfrb_aircraft_tracked", "Aircrafts in store")),
+      m_reported(metrics.gauge("vfrb_aircraft_reported", "Aircrafts reported in the last cycle"))
 {
-    m_container.reserve(ESTIMATED_TRAFFIC);
-    m_index.reserve(ESTIMATED_TRAFFIC * 2);
+    const std::size_t estimated = ESTIMATED_TRAFFIC / m_shards.size() + 1;
+    for (auto& shard : m_shards)
+    {
+        shard.container.reserve(estimated);
+        shard.reports.reserve(estimated);
+        shard.index.reserve(estimated);
+        shard.active.reserve(estimated);
+    }
 }
 
 void AircraftData::get_serialized(std::string& dest)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
-    for (const auto& it : m_container)
+    m_updated = false;
+    for (auto& shard : m_shards)
     {
-        dest += it.get_updateAge() < OBJ_OUTDATED ? it.get_serialized() : "";
+        std::lock_guard<std::mutex> shardLock(shard.mutex);
+        for (auto index : shard.active)
+        {
+            dest += shard.reports[index];
+        }
     }
 }
 
 bool AircraftData::update(Object&& aircraft)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
     Aircraft&&                  update = static_cast<Aircraft&&>(aircraft);
-    const auto                  index  = m_index.find(update.get_id());
+    Shard&                      shard  = shardOf(update.get_id());
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (!shard.grid.contains(update.get_position().latitude, update.get_position().longitude))
+    {
+        if (update.get_metrics())
+        {
+            update.get_metrics()->updatesCulled.add();
+        }
+        return false;
+    }
+    const AircraftRecord record(update);
+    const std::uint32_t  index = shard.index.find(update.get_id());
+
+    if (index != util::FlatIndex::NONE)
+    {
+        if (!shard.container[index].tryUpdate(record))
+        {
+            return false;
+        }
+        // the report is outdated until processed again
+        shard.reports[index].clear();
+        return true;
+    }
+    if (update.get_metrics())
+    {
+        update.get_metrics()->countUpdate(true, update.get_received());
+    }
+    insert(shard, record);
+    return true;
+}
 
-    if (index != m_index.end())
+bool AircraftData::enqueue(Object&& aircraft)
+{
+    if (!m_queue.push(static_cast<Aircraft&&>(aircraft)))
     {
-        return m_container[index->second].tryUpdate(std::move(aircraft));
+        return false;
     }
-    insert(std::move(update));
+    notify();
     return true;
 }
 
-void AircraftData::processAircrafts(const Position& position, double atmPress) noexcept
+std::size_t AircraftData::enqueue(std::vector<Aircraft>& aircrafts)
+{
+    const std::size_t queued = m_queue.push(aircrafts.data(), aircrafts.size());
+    if (queued > 0)
+    {
+        notify();
+    }
+    return queued;
+}
+
+std::size_t AircraftData::flush()
+{
+    std::size_t applied = 0;
+    Aircraft    aircraft;
+    while (m_queue.pop(aircraft))
+    {
+        if (update(std::move(aircraft)))
+        {
+            ++applied;
+        }
+    }
+    return applied;
+}
+
+std::size_t AircraftData::get_queueDepth() const
+{
+    return m_queue.get_depth();
+}
+
+std::uint64_t AircraftData::get_queueDrops() const
+{
+    return m_queue.get_drops();
+}
+
+void AircraftData::processAircrafts(const Position& position, double atmPress, bool age,
+                                    std::string* updated) noexcept
 {
     std::lock_guard<std::mutex> lock(m_mutex);
-    std::size_t                 index = 0;
-    bool                        del   = false;
-    auto                        it    = m_container.begin();
+    std::size_t                 tracked  = 0;
+    std::size_t                 reported = 0;
     m_processor.referTo(position, atmPress);
+    const bool moved = m_grid.moveTo(position.latitude, position.longitude);
+    if (age)
+    {
+        // not sent within a second, so not recorded at all; bounds the memory
+        m_processed.clear();
+    }
+    const std::size_t unsent = m_processed.size();
 
-    while (it != m_container.end())
+    for (auto& shard : m_shards)
     {
-        ++(*it);
-        try
+        std::lock_guard<std::mutex> shardLock(shard.mutex);
+        if (moved)
         {
+            shard.grid = m_grid;
+        }
+        processShard(shard, age, updated);
+        tracked  += shard.container.size();
+        reported += shard.active.size();
+    }
+    const auto now = std::chrono::steady_clock::now();
+    for (auto it = m_processed.cbegin() + unsent; it != m_processed.cend(); ++it)
+    {
+        it->first->processLatency.observe(now - it->second);
+    }
+    m_tracked.set(static_cast<double>(tracked));
+    m_reported.set(static_cast<double>(reported));
+}
+
+void AircraftData::markSent() noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto                  now = std::chrono::steady_clock::now();
+    for (const auto& it : m_processed)
+    {
+        it.first->sendLatency.observe(now - it.second);
+    }
+    m_processed.clear();
+}
+
+AircraftData::Shard& AircraftData::shardOf(std::uint32_t id)
+{
+    return m_shards[id % m_shards.size()];
+}
+
+void AircraftData::insert(Shard& shard, const object::AircraftRecord& aircraft)
+{
+    shard.index.set(aircraft.get_id(), static_cast<std::uint32_t>(shard.container.size()));
+    shard.container.push_back(aircraft);
+    shard.reports.emplace_back();
+}
+
+void AircraftData::remove(Shard& shard, std::size_t index)
+{
+    shard.index.erase(shard.container[index].get_id());
+    if (index + 1 < shard.container.size())
+    {
+        shard.container[index] = shard.container.back();
+        shard.reports[index].swap(shard.reports.back());
+        shard.index.set(shard.container[index].get_id(), static_cast<std::uint32_t>(index));
+    }
+    shard.container.pop_back();
+    shard.reports.pop_back();
+}
+
+void AircraftData::processShard(Shard& shard, bool age, std::string* updated)
+{
+    std::size_t index = 0;
+    shard.active.clear();
+
+    while (index < shard.container.size())
+    {
+        AircraftRecord& aircraft = shard.container[index];
+        if (age)
+        {
+            ++aircraft;
             // if no FLARM msg received after x, assume target has Transponder
-            if (it->get_updateAge() == AC_NO_FLARM_THRESHOLD)
+            if (aircraft.get_updateAge() == AC_NO_FLARM_THRESHOLD)
             {
-                it->set_targetType(Aircraft::TargetType::TRANSPONDER);
+                aircraft.set_targetType(Aircraft::TargetType::TRANSPONDER);
             }
-            if (it->get_updateAge() >= AC_DELETE_THRESHOLD)
+            if (aircraft.get_updateAge() >= AC_DELETE_THRESHOLD)
             {
-                del = true;
-                m_index.erase(it->get_id());
-                it = m_container.erase(it);
+                // the last aircraft is moved here, and not yet processed
+                remove(shard, index);
+                continue;
             }
-            else
+        }
+        if (aircraft.get_due())
+        {
+            aircraft.set_due(false);
+            m_due.push_back(&aircraft);
+            m_dueReports.push_back(&shard.reports[index]);
+            if (aircraft.get_metrics() && aircraft.get_received().time_since_epoch().count() != 0)
             {
-                if (it->get_updateAge() == 1)
-                {
-                    m_processor.process(*it);
-                }
-                ++it;
-                ++index;
+                m_processed.emplace_back(aircraft.get_metrics(), aircraft.get_received());
             }
-            if (del && it != m_container.end())
+        }
+        if (aircraft.get_updateAge() < OBJ_OUTDATED)
+        {
+            shard.active.push_back(index);
+        }
+        ++index;
+    }
+    // removal only moves aircrafts not yet visited, so the pointers stay valid
+    try
+    {
+        m_processor.process(m_due, m_dueReports);
+    }
+    catch (const std::exception&)
+    {
+        // fall back to single aircrafts, so only a failing one is skipped
+        for (std::size_t i = 0; i < m_due.size(); ++i)
+        {
+            try
+            {
+                m_processor.process(*m_due[i], *m_dueReports[i]);
+            }
+            catch (const std::exception&)
             {
-                m_index.at(it->get_id()) = index;
+                m_dueReports[i]->clear();
             }
         }
-        catch (const std::exception&)
-        {}
     }
-}
-
-void AircraftData::insert(object::Aircraft&& aircraft)
-{
-    m_index.insert({aircraft.get_id(), m_container.size()});
-    m_container.push_back(std::move(aircraft));
+    m_updated = m_updated || !m_due.empty();
+    if (updated)
+    {
+        for (const auto it : m_dueReports)
+        {
+            *updated += *it;
+        }
+    }
+    m_due.clear();
+    m_dueReports.clear();
 }
 }  // namespace data
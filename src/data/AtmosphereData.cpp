@@ -33,12 +33,21 @@ void AtmosphereData::get_serialized(std::string& dest)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
     dest += (++m_atmosphere).get_serialized();
+    m_updated = false;
 }
 
 bool AtmosphereData::update(Object&& atmosphere)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    return m_atmosphere.tryUpdate(std::move(atmosphere));
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_atmosphere.tryUpdate(static_cast<Atmosphere&&>(atmosphere)))
+        {
+            return false;
+        }
+        m_updated = true;
+    }
+    notify();
+    return true;
 }
 
 double AtmosphereData::get_atmPressure()
@@ -35,14 +35,22 @@
 /// Good horizontal dilution
 #define GPS_HOR_DILUTION_GOOD 1.0
 
+/// @def GPS_QUEUE_SIZE
+/// Capacity of the update queue
+#define GPS_QUEUE_SIZE 16
+
 using namespace object;
 
 namespace data
 {
-GpsData::GpsData() : Data() {}
+GpsData::GpsData() : Data(), m_positionLocked(false), m_queue(GPS_QUEUE_SIZE) {}
 
 GpsData::GpsData(const GpsPosition& position, bool ground)
-    : Data(), m_position(position), m_groundMode(ground)
+    : Data(),
+      m_position(position),
+      m_positionLocked(false),
+      m_groundMode(ground),
+      m_queue(GPS_QUEUE_SIZE)
 {
     m_processor.process(m_position);
 }
@@ -52,6 +60,7 @@ void GpsData::get_serialized(std::string& dest)
     std::lock_guard<std::mutex> lock(m_mutex);
     m_processor.process(m_position);
     dest += (++m_position).get_serialized();
+    m_updated = false;
 }
 
 bool GpsData::update(Object&& position)
@@ -61,9 +70,10 @@ bool GpsData::update(Object&& position)
     {
         throw PositionAlreadyLocked();
     }
-    bool updated = m_position.tryUpdate(std::move(position));
+    bool updated = m_position.tryUpdate(static_cast<GpsPosition&&>(position));
     if (updated)
     {
+        m_updated = true;
         m_processor.process(m_position);
         if (m_groundMode && isPositionGood())
         {
@@ -73,6 +83,45 @@ bool GpsData::update(Object&& position)
     return updated;
 }
 
+bool GpsData::enqueue(Object&& position)
+{
+    if (m_positionLocked)
+    {
+        throw PositionAlreadyLocked();
+    }
+    if (!m_queue.push(static_cast<GpsPosition&&>(position)))
+    {
+        return false;
+    }
+    notify();
+    return true;
+}
+
+std::size_t GpsData::flush()
+{
+    std::size_t applied = 0;
+    GpsPosition position;
+    while (m_queue.pop(position))
+    {
+        try
+        {
+            if (update(std::move(position)))
+            {
+                ++applied;
+            }
+        }
+        catch (const ReceivedGoodPosition&)
+        {
+            // applied, then locked
+            ++applied;
+            m_positionLocked = true;
+        }
+        catch (const PositionAlreadyLocked&)
+        {}
+    }
+    return applied;
+}
+
 Position GpsData::get_position()
 {
     std::lock_guard<std::mutex> lock(m_mutex);
@@ -34,12 +34,21 @@ void WindData::get_serialized(std::string& dest)
     std::lock_guard<std::mutex> lock(m_mutex);
     dest += (++m_wind).get_serialized();
     m_wind.set_serialized("");
+    m_updated = false;
 }
 
 bool WindData::update(Object&& wind)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    return m_wind.tryUpdate(std::move(wind));
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_wind.tryUpdate(static_cast<Wind&&>(wind)))
+        {
+            return false;
+        }
+        m_updated = true;
+    }
+    notify();
+    return true;
 }
 
 }  // namespace data
@@ -22,10 +22,10 @@
 #include "data/processor/AircraftProcessor.h"
 
 #include <cmath>
-#include <cstdio>
 #include <limits>
 
 #include "util/math.hpp"
+#include "util/simd.hpp"
 #include "util/utility.hpp"
 
 using namespace object;
@@ -34,92 +34,284 @@ namespace data
 {
 namespace processor
 {
+namespace
+{
+/**
+ * @brief Check whether a position is on the globe.
+ * @param position The position
+ * @return true if yes, else false
+ */
+inline bool onGlobe(const Position& position)
+{
+    return std::abs(position.latitude) <= 90.0 && std::abs(position.longitude) <= 180.0;
+}
+}  // namespace
+
 AircraftProcessor::AircraftProcessor() : AircraftProcessor(std::numeric_limits<std::int32_t>::max())
 {}
 
-AircraftProcessor::AircraftProcessor(std::int32_t maxDist)
-    : Processor<object::Aircraft>(), m_maxDistance(maxDist)
-{}
+AircraftProcessor::AircraftProcessor(std::int32_t maxDist) : AircraftProcessor(maxDist, 0) {}
+
+AircraftProcessor::AircraftProcessor(std::int32_t maxDist, std::int32_t localRadius)
+    : Processor<object::Aircraft>(), m_maxDistance(maxDist), m_localRadius(localRadius)
+{
+    referTo(m_refPosition, m_refAtmPressure);
+}
 
 void AircraftProcessor::process(Aircraft& aircraft)
 {
+    process(AircraftRecord(aircraft), m_processed);
+    aircraft.set_serialized(std::move(m_processed));
+}
+
+void AircraftProcessor::process(const AircraftRecord& aircraft, std::string& dest)
+{
+    if (!onGlobe(aircraft.get_position()))
+    {
+        dest.clear();
+        return;
+    }
     calculateRelPosition(aircraft);
-    m_processed.clear();
-    if (m_distance <= m_maxDistance)
+    serialize(aircraft, dest);
+}
+
+void AircraftProcessor::process(const std::vector<const AircraftRecord*>& aircrafts,
+                                const std::vector<std::string*>&          reports)
+{
+    const std::size_t count  = aircrafts.size();
+    const std::size_t padded = (count + SIMD_LANES - 1) / SIMD_LANES * SIMD_LANES;
+    m_batch.latitude.resize(padded);
+    m_batch.longitude.resize(padded);
+    m_batch.distance.resize(padded);
+    m_batch.bearing.resize(padded);
+    m_batch.north.resize(padded);
+    m_batch.east.resize(padded);
+    for (std::size_t i = 0; i < count; ++i)
     {
-        appendPFLAU(aircraft);
-        appendPFLAA(aircraft);
-        aircraft.set_serialized(std::move(m_processed));
+        const Position position = aircrafts[i]->get_position();
+        // invalid positions are not reported, but computed at the refered one to keep packs local
+        const bool valid     = onGlobe(position);
+        m_batch.latitude[i]  = valid ? math::radian(position.latitude) : m_refRadLatitude;
+        m_batch.longitude[i] = valid ? math::radian(position.longitude) : m_refRadLongitude;
     }
-    else
+    // padding at the refered position keeps packs local
+    for (std::size_t i = count; i < padded; ++i)
     {
-        aircraft.set_serialized("");
+        m_batch.latitude[i]  = m_refRadLatitude;
+        m_batch.longitude[i] = m_refRadLongitude;
+    }
+    calculateRelPositions(padded);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const AircraftRecord& aircraft = *aircrafts[i];
+        if (!onGlobe(aircraft.get_position()))
+        {
+            reports[i]->clear();
+            continue;
+        }
+        m_distance                     = math::doubleToInt(m_batch.distance[i]);
+        m_relBearing                   = m_batch.bearing[i];
+        m_relNorth                     = math::doubleToInt(m_batch.north[i] * m_distance);
+        m_relEast                      = math::doubleToInt(m_batch.east[i] * m_distance);
+        calculateRelVertical(aircraft);
+        serialize(aircraft, *reports[i]);
+    }
+}
+
+void AircraftProcessor::serialize(const AircraftRecord& aircraft, std::string& dest)
+{
+    dest.clear();
+    if (m_distance <= m_maxDistance)
+    {
+        appendPFLAU(aircraft, dest);
+        appendPFLAA(aircraft, dest);
     }
 }
 
 void AircraftProcessor::referTo(const Position& position, double atmPress)
 {
-    m_refPosition    = position;
-    m_refAtmPressure = atmPress;
+    using namespace math::simd;
+
+    m_refPosition     = position;
+    m_refAtmPressure  = atmPress;
+    m_refRadLatitude  = math::radian(position.latitude);
+    m_refRadLongitude = math::radian(position.longitude);
+    m_refSinLatitude  = std::sin(m_refRadLatitude);
+    m_refCosLatitude  = std::cos(m_refRadLatitude);
+    m_refIcaoHeight   = math::icaoHeight(atmPress);
+
+    // the batch kernel uses its own functions for the reference too, so equal latitudes cancel
+    Pack   sin, cos;
+    double lanes[SIMD_LANES];
+    sincos(splat(m_refRadLatitude), sin, cos);
+    store(lanes, sin);
+    m_batchRefSinLatitude = lanes[0];
+    store(lanes, cos);
+    m_batchRefCosLatitude = lanes[0];
 }
 
-void AircraftProcessor::calculateRelPosition(const Aircraft& aircraft)
+void AircraftProcessor::calculateRelPosition(const AircraftRecord& aircraft)
 {
-    m_refRadLatitude       = math::radian(m_refPosition.latitude);
-    m_refRadLongitude      = math::radian(m_refPosition.longitude);
-    m_aircraftRadLongitude = math::radian(aircraft.get_position().longitude);
-    m_aircraftRadLatitude  = math::radian(aircraft.get_position().latitude);
+    const Position position = aircraft.get_position();
+    m_aircraftRadLongitude  = math::radian(position.longitude);
+    m_aircraftRadLatitude   = math::radian(position.latitude);
     m_lonDistance          = m_aircraftRadLongitude - m_refRadLongitude;
     m_latDistance          = m_aircraftRadLatitude - m_refRadLatitude;
+    calculateRelVertical(aircraft);
+    if (m_localRadius > 0 && calculateLocalPosition())
+    {
+        return;
+    }
+
+    const double aircraftCosLatitude = std::cos(m_aircraftRadLatitude);
+    const double a =
+        std::pow(std::sin(m_latDistance / 2.0), 2.0) +
+        m_refCosLatitude * aircraftCosLatitude * std::pow(std::sin(m_lonDistance / 2.0), 2.0);
+    m_distance = math::doubleToInt(math::EARTH_RADIUS *
+                                   (2.0 * std::atan2(std::sqrt(a), std::sqrt(1.0 - a))));
 
-    double a = std::pow(std::sin(m_latDistance / 2.0), 2.0) +
-               std::cos(m_refRadLatitude) * std::cos(m_aircraftRadLatitude) *
-                   std::pow(std::sin(m_lonDistance / 2.0), 2.0);
-    m_distance =
-        math::doubleToInt(6371000.0 * (2.0 * std::atan2(std::sqrt(a), std::sqrt(1.0 - a))));
-
-    m_relBearing = math::degree(std::atan2(
-        std::sin(m_aircraftRadLongitude - m_refRadLongitude) * std::cos(m_aircraftRadLatitude),
-        std::cos(m_refRadLatitude) * std::sin(m_aircraftRadLatitude) -
-            std::sin(m_refRadLatitude) * std::cos(m_aircraftRadLatitude) *
-                std::cos(m_aircraftRadLongitude - m_refRadLongitude)));
+    m_relBearing = math::degree(
+        std::atan2(std::sin(m_lonDistance) * aircraftCosLatitude,
+                   m_refCosLatitude * std::sin(m_aircraftRadLatitude) -
+                       m_refSinLatitude * aircraftCosLatitude * std::cos(m_lonDistance)));
     m_absBearing = std::fmod((m_relBearing + 360.0), 360.0);
 
-    m_relNorth    = math::doubleToInt(std::cos(math::radian(m_absBearing)) * m_distance);
-    m_relEast     = math::doubleToInt(std::sin(math::radian(m_absBearing)) * m_distance);
+    m_relNorth = math::doubleToInt(std::cos(math::radian(m_absBearing)) * m_distance);
+    m_relEast  = math::doubleToInt(std::sin(math::radian(m_absBearing)) * m_distance);
+}
+
+bool AircraftProcessor::calculateLocalPosition()
+{
+    // equirectangular at the mean latitude, to first order
+    const double scale      = m_refCosLatitude - m_refSinLatitude * m_latDistance / 2.0;
+    const double planeNorth = math::EARTH_RADIUS * m_latDistance;
+    const double planeEast  = math::EARTH_RADIUS * m_lonDistance * scale;
+    // rotate by the meridian convergence, to get the initial bearing of the great circle
+    const double convergence = m_lonDistance * m_refSinLatitude / 2.0;
+    const double north       = planeNorth + planeEast * convergence;
+    const double east        = planeEast - planeNorth * convergence;
+
+    const double distance = std::sqrt(north * north + east * east);
+    if (distance > m_localRadius)
+    {
+        return false;
+    }
+    m_distance   = math::doubleToInt(distance);
+    m_relBearing = math::degree(std::atan2(east, north));
+    m_relNorth   = math::doubleToInt(distance > 0.0 ? north / distance * m_distance : 0.0);
+    m_relEast    = math::doubleToInt(distance > 0.0 ? east / distance * m_distance : 0.0);
+    return true;
+}
+
+void AircraftProcessor::calculateRelPositions(std::size_t count)
+{
+    using namespace math::simd;
+
+    const Pack   refSin = splat(m_refSinLatitude);
+    const Pack   refCos = splat(m_refCosLatitude);
+    const double radius = static_cast<double>(m_localRadius);
+
+    for (std::size_t i = 0; i < count; i += SIMD_LANES)
+    {
+        const Pack latitude = load(&m_batch.latitude[i]);
+        const Pack lonDist  = load(&m_batch.longitude[i]) - m_refRadLongitude;
+        const Pack latDist  = latitude - m_refRadLatitude;
+        Pack       north{}, east{}, distance{}, norm{};
+        Mask       local{};
+
+        // local plane, like calculateLocalPosition
+        if (m_localRadius > 0)
+        {
+            const Pack scale       = refCos - refSin * latDist / 2.0;
+            const Pack convergence = lonDist * refSin / 2.0;
+            const Pack planeNorth  = math::EARTH_RADIUS * latDist;
+            const Pack planeEast   = math::EARTH_RADIUS * lonDist * scale;
+            north                  = planeNorth + planeEast * convergence;
+            east                   = planeEast - planeNorth * convergence;
+            distance               = sqrt(north * north + east * east);
+            norm                   = distance;
+            local                  = distance <= radius;
+        }
+        if (!all(local))
+        {
+            const Pack refKernelSin = splat(m_batchRefSinLatitude);
+            const Pack refKernelCos = splat(m_batchRefCosLatitude);
+            Pack       latSin, latCos, lonSin, lonCos, halfLatSin, halfLonSin, unused;
+            sincos(latitude, latSin, latCos);
+            sincos(lonDist, lonSin, lonCos);
+            sincos(latDist / 2.0, halfLatSin, unused);
+            sincos(lonDist / 2.0, halfLonSin, unused);
+
+            // haversine, and the initial bearing as vector
+            const Pack a =
+                halfLatSin * halfLatSin + refKernelCos * latCos * halfLonSin * halfLonSin;
+            const Pack y = lonSin * latCos;
+            const Pack x = refKernelCos * latSin - refKernelSin * latCos * lonCos;
+            distance     = select(local, distance,
+                                  math::EARTH_RADIUS * (2.0 * atan2(sqrt(a), sqrt(1.0 - a))));
+            norm         = select(local, norm, sqrt(x * x + y * y));
+            north        = select(local, north, x);
+            east         = select(local, east, y);
+        }
+
+        // the unit vector of the bearing scales the rounded distance to the offsets
+        const Mask zero = norm == 0.0;
+        store(&m_batch.distance[i], distance);
+        store(&m_batch.bearing[i], (atan2(east, north) * 180.0) / math::PI);
+        store(&m_batch.north[i], select(zero, splat(1.0), north / norm));
+        store(&m_batch.east[i], select(zero, splat(0.0), east / norm));
+    }
+}
+
+void AircraftProcessor::calculateRelVertical(const AircraftRecord& aircraft)
+{
     m_relVertical = aircraft.get_targetType() == Aircraft::TargetType::TRANSPONDER ?
-                        aircraft.get_position().altitude - math::icaoHeight(m_refAtmPressure) :
-                        aircraft.get_position().altitude - m_refPosition.altitude;
+                        aircraft.get_altitude() - m_refIcaoHeight :
+                        aircraft.get_altitude() - m_refPosition.altitude;
 }
 
-void AircraftProcessor::appendPFLAU(const Aircraft& aircraft)
+void AircraftProcessor::appendPFLAU(const AircraftRecord& aircraft, std::string& dest)
 {
-    std::snprintf(m_buffer, sizeof(m_buffer), "$PFLAU,,,,1,0,%d,0,%d,%d,%s*",
-                  math::doubleToInt(m_relBearing), m_relVertical, m_distance,
-                  aircraft.get_id().c_str());
-    m_processed.append(m_buffer);
-    finishSentence();
+    NmeaWriter writer(dest);
+    writer.begin("PFLAU,,,,1,0,")
+        .appendInt(math::doubleToInt(m_relBearing))
+        .append(",0,")
+        .appendInt(m_relVertical)
+        .field()
+        .appendInt(m_distance)
+        .field()
+        .appendHex(aircraft.get_id(), 6)
+        .finish();
 }
 
-void AircraftProcessor::appendPFLAA(const Aircraft& aircraft)
+void AircraftProcessor::appendPFLAA(const AircraftRecord& aircraft, std::string& dest)
 {
+    NmeaWriter writer(dest);
+    writer.begin("PFLAA,0,")
+        .appendInt(m_relNorth)
+        .field()
+        .appendInt(m_relEast)
+        .field()
+        .appendInt(m_relVertical)
+        .field();
     if (aircraft.get_fullInfo())
     {
-        std::snprintf(
-            m_buffer, sizeof(m_buffer), "$PFLAA,0,%d,%d,%d,%hhu,%s,%03d,,%d,%3.1lf,%1hhX*",
-            m_relNorth, m_relEast, m_relVertical, util::raw_type(aircraft.get_idType()),
-            aircraft.get_id().c_str(), math::doubleToInt(aircraft.get_movement().heading),
-            math::doubleToInt(aircraft.get_movement().gndSpeed * math::MS_2_KMH),
-            aircraft.get_movement().climbRate, util::raw_type(aircraft.get_aircraftType()));
+        writer.appendInt(util::raw_type(aircraft.get_idType()))
+            .field()
+            .appendHex(aircraft.get_id(), 6)
+            .field()
+            .appendInt(aircraft.get_heading(), 3)
+            .append(",,")
+            .appendInt(aircraft.get_gndSpeed())
+            .field()
+            .appendFixed(aircraft.get_climbRate(), 1)
+            .field();
     }
     else
     {
-        std::snprintf(m_buffer, sizeof(m_buffer), "$PFLAA,0,%d,%d,%d,1,%s,,,,,%1hhX*", m_relNorth,
-                      m_relEast, m_relVertical, aircraft.get_id().c_str(),
-                      util::raw_type(aircraft.get_aircraftType()));
+        writer.append("1,").appendHex(aircraft.get_id(), 6).append(",,,,,");
     }
-    m_processed.append(m_buffer);
-    finishSentence();
+    writer.appendHex(util::raw_type(aircraft.get_aircraftType())).finish();
 }
 
 }  // namespace processor
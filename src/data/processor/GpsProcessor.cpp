@@ -22,7 +22,6 @@
 #include "data/processor/GpsProcessor.h"
 
 #include <cmath>
-#include <cstdio>
 #include <ctime>
 
 using namespace object;
@@ -48,27 +47,54 @@ void GpsProcessor::appendGPGGA(const GpsPosition& position, const std::tm* utc)
 {
     // As we use XCSoar as frontend, we need to set the fix quality to 1. It doesn't
     // support others.
-    std::snprintf(
-        m_buffer, sizeof(m_buffer),
-        /*"$GPGGA,%02d%02d%02d,%02.0lf%07.4lf,%c,%03.0lf%07.4lf,%c,%1d,%02d,1,%d,M,%.1lf,M,,*"*/
-        "$GPGGA,%02d%02d%02d,%02.0lf%07.4lf,%c,%03.0lf%07.4lf,%c,1,%02hhu,1,%d,M,%.1lf,M,,*",
-        utc->tm_hour, utc->tm_min, utc->tm_sec, m_degLatitude, m_minLatitude, m_directionSN,
-        m_degLongitude, m_minLongitude, m_directionEW, /*pos.fixQa,*/ position.get_nrOfSatellites(),
-        position.get_position().altitude, position.get_geoid());
-    m_processed.append(m_buffer);
-    finishSentence();
+    NmeaWriter writer(m_processed);
+    writer.begin("GPGGA,")
+        .appendInt(utc->tm_hour, 2)
+        .appendInt(utc->tm_min, 2)
+        .appendInt(utc->tm_sec, 2)
+        .field()
+        .appendFixed(m_degLatitude, 0, 2)
+        .appendFixed(m_minLatitude, 4, 7)
+        .field()
+        .append(m_directionSN)
+        .field()
+        .appendFixed(m_degLongitude, 0, 3)
+        .appendFixed(m_minLongitude, 4, 7)
+        .field()
+        .append(m_directionEW)
+        .append(",1,")
+        .appendInt(position.get_nrOfSatellites(), 2)
+        .append(",1,")
+        .appendInt(position.get_position().altitude)
+        .append(",M,")
+        .appendFixed(position.get_geoid(), 1)
+        .append(",M,,")
+        .finish();
 }
 
 void GpsProcessor::appendGPRMC(const std::tm* utc)
 {
-    std::snprintf(
-        m_buffer, sizeof(m_buffer),
-        "$GPRMC,%02d%02d%02d,A,%02.0lf%05.2lf,%c,%03.0lf%05.2lf,%c,0,0,%02d%02d%02d,001.0,W*",
-        utc->tm_hour, utc->tm_min, utc->tm_sec, m_degLatitude, m_minLatitude, m_directionSN,
-        m_degLongitude, m_minLongitude, m_directionEW, utc->tm_mday, utc->tm_mon + 1,
-        utc->tm_year - 100);
-    m_processed.append(m_buffer);
-    finishSentence();
+    NmeaWriter writer(m_processed);
+    writer.begin("GPRMC,")
+        .appendInt(utc->tm_hour, 2)
+        .appendInt(utc->tm_min, 2)
+        .appendInt(utc->tm_sec, 2)
+        .append(",A,")
+        .appendFixed(m_degLatitude, 0, 2)
+        .appendFixed(m_minLatitude, 2, 5)
+        .field()
+        .append(m_directionSN)
+        .field()
+        .appendFixed(m_degLongitude, 0, 3)
+        .appendFixed(m_minLongitude, 2, 5)
+        .field()
+        .append(m_directionEW)
+        .append(",0,0,")
+        .appendInt(utc->tm_mday, 2)
+        .appendInt(utc->tm_mon + 1, 2)
+        .appendInt(utc->tm_year - 100, 2)
+        .append(",001.0,W")
+        .finish();
 }
 
 void GpsProcessor::evalPosition(double latitude, double longitude)
@@ -0,0 +1,155 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include "data/processor/NmeaWriter.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#include "util/math.hpp"
+
+namespace data
+{
+namespace processor
+{
+namespace
+{
+/// Powers of 10 up to the max amount of decimals
+constexpr std::uint64_t POW10[] = {1,      10,      100,      1000,      10000,
+                                   100000, 1000000, 10000000, 100000000, 1000000000};
+
+/// Max magnitude of scaled numbers, which are formatted exactly
+constexpr double MAX_SCALED = 4.0e15;
+
+/**
+ * @brief Write the decimal digits of a number backwards.
+ * @param value The number
+ * @param pos   The position after the last digit
+ * @param min   The min amount of digits, padded with zeros
+ * @return the position of the first digit
+ */
+inline char* writeDigits(std::uint64_t value, char* pos, std::size_t min)
+{
+    char* end = pos;
+    do
+    {
+        *--pos = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    while (static_cast<std::size_t>(end - pos) < min)
+    {
+        *--pos = '0';
+    }
+    return pos;
+}
+}  // namespace
+
+NmeaWriter::NmeaWriter(std::string& dest) : m_dest(dest) {}
+
+NmeaWriter& NmeaWriter::append(const char* str)
+{
+    return append(str, std::strlen(str));
+}
+
+NmeaWriter& NmeaWriter::append(const char* str, std::size_t len)
+{
+    for (std::size_t i = 0; i < len; ++i)
+    {
+        m_checksum ^= static_cast<std::uint8_t>(str[i]);
+    }
+    m_dest.append(str, len);
+    return *this;
+}
+
+NmeaWriter& NmeaWriter::appendInt(std::int64_t value, std::uint32_t width)
+{
+    char          buffer[32];
+    char*         end       = buffer + sizeof(buffer);
+    std::uint64_t magnitude = value < 0 ? 0 - static_cast<std::uint64_t>(value) :
+                                          static_cast<std::uint64_t>(value);
+    std::size_t   sign      = value < 0 ? 1 : 0;
+    std::size_t   min       = width > sign ? width - sign : 0;
+    char*         pos       = writeDigits(magnitude, end, min < 20 ? min : 20);
+    if (sign > 0)
+    {
+        *--pos = '-';
+    }
+    return append(pos, static_cast<std::size_t>(end - pos));
+}
+
+NmeaWriter& NmeaWriter::appendFixed(double value, std::uint32_t decimals, std::uint32_t width)
+{
+    if (!std::isfinite(value) || decimals > 9 ||
+        std::fabs(value) * static_cast<double>(POW10[decimals < 9 ? decimals : 9]) >= MAX_SCALED)
+    {
+        char buffer[512];
+        int  len = std::snprintf(buffer, sizeof(buffer), "%0*.*f", static_cast<int>(width),
+                                 static_cast<int>(decimals), value);
+        return append(buffer, len > 0 ? static_cast<std::size_t>(len) : 0);
+    }
+    const double  scale  = static_cast<double>(POW10[decimals]);
+    std::uint64_t digits = math::roundScaled(std::fabs(value), scale);
+
+    char        buffer[48];
+    char*       end  = buffer + sizeof(buffer);
+    char*       pos  = end;
+    std::size_t sign = std::signbit(value) ? 1 : 0;
+    if (decimals > 0)
+    {
+        pos    = writeDigits(digits % POW10[decimals], pos, decimals);
+        *--pos = '.';
+    }
+    std::size_t used = static_cast<std::size_t>(end - pos) + sign;
+    std::size_t min  = width > used ? width - used : 1;
+    pos              = writeDigits(digits / POW10[decimals], pos, min < 20 ? min : 20);
+    if (sign > 0)
+    {
+        *--pos = '-';
+    }
+    return append(pos, static_cast<std::size_t>(end - pos));
+}
+
+NmeaWriter& NmeaWriter::appendHex(std::uint32_t value, std::uint32_t width)
+{
+    static constexpr const char* digits = "0123456789ABCDEF";
+    char                         buffer[8];
+    char*                        end = buffer + sizeof(buffer);
+    char*                        pos = end;
+    char*                        min = end - (width < sizeof(buffer) ? width : sizeof(buffer));
+    do
+    {
+        *--pos = digits[value & 0xF];
+        value >>= 4;
+    } while (value > 0 || pos > min);
+    return append(pos, static_cast<std::size_t>(end - pos));
+}
+
+void NmeaWriter::finish()
+{
+    static constexpr const char* digits   = "0123456789abcdef";
+    const char                   suffix[] = {'*', digits[m_checksum >> 4],
+                                             digits[m_checksum & 0xF], '\r', '\n'};
+    m_dest.append(suffix, sizeof(suffix));
+}
+
+}  // namespace processor
+}  // namespace data
@@ -21,13 +21,19 @@
 
 #include "feed/AprscFeed.h"
 
+#include <cstdio>
+#include <limits>
 #include <stdexcept>
 
 #include "config/Configuration.h"
 #include "data/AircraftData.h"
+#include "data/GpsData.h"
+#include "feed/parser/Classifier.h"
 #include "feed/parser/AprsParser.h"
 #include "object/Aircraft.h"
+#include "util/Metrics.h"
 #include "util/Logger.hpp"
+#include "util/math.hpp"
 
 #ifdef COMPONENT
 #    undef COMPONENT
@@ -39,8 +45,13 @@ namespace feed
 parser::AprsParser AprscFeed::s_parser;
 
 AprscFeed::AprscFeed(const std::string& name, const config::Properties& properties,
-                     std::shared_ptr<data::AircraftData> data, std::int32_t maxHeight)
-    : Feed(name, COMPONENT, properties, data)
+                     std::shared_ptr<data::AircraftData> data, std::int32_t maxHeight,
+                     std::shared_ptr<data::GpsData> gpsData, std::int32_t maxDistance)
+    : Feed(name, COMPONENT, properties, data),
+      m_aircraftData(data),
+      m_gpsData(gpsData),
+      m_filterTerms(m_properties.get_property(KV_KEY_FILTER_TERMS, "")),
+      m_regexFallback(!m_properties.get_property(KV_KEY_REGEX_FALLBACK, "").empty())
 {
     parser::AprsParser::s_maxHeight = maxHeight;
     if (m_properties.get_property(KV_KEY_LOGIN, "-") == "-")
@@ -48,6 +59,26 @@ AprscFeed::AprscFeed(const std::string& name, const config::Properties& properti
         logger.warn(m_component, " could not find: ", m_name, "." KV_KEY_LOGIN);
         throw std::logic_error("No login given");
     }
+    if (!m_properties.get_property(KV_KEY_AUTO_FILTER, "").empty())
+    {
+        if (get_login().find(" filter ") != std::string::npos)
+        {
+            logger.warn(m_component, " ", m_name, "." KV_KEY_LOGIN,
+                        " contains a filter, not generating one");
+        }
+        else if (!m_gpsData)
+        {
+            logger.warn(m_component, " ", m_name, " has no position to generate a filter for");
+        }
+        else
+        {
+            if (maxDistance < std::numeric_limits<std::int32_t>::max())
+            {
+                m_filterRange = (std::int64_t(maxDistance) + AF_FILTER_MARGIN + 999) / 1000;
+            }
+            m_autoFilter = m_filterRange > 0 || !m_filterTerms.empty();
+        }
+    }
 }
 
 Feed::Protocol AprscFeed::get_protocol() const
@@ -57,10 +88,36 @@ Feed::Protocol AprscFeed::get_protocol() const
 
 bool AprscFeed::process(const std::string& response)
 {
-    object::Aircraft ac(get_priority());
-    if (s_parser.unpack(response, ac))
+    return processBatch({util::StringView(response)});
+}
+
+bool AprscFeed::processBatch(const std::vector<util::StringView>& responses)
+{
+    std::size_t skipped = 0;
+    m_batch.clear();
+    for (const auto& it : responses)
+    {
+        if (!classify(it))
+        {
+            ++skipped;
+            continue;
+        }
+        m_batch.emplace_back(get_priority());
+        if (!s_parser.unpackView(it, m_batch.back(), m_regexFallback))
+        {
+            m_batch.pop_back();
+        }
+        else
+        {
+            tag(m_batch.back());
+        }
+    }
+    parsed(m_batch.size());
+    m_metrics.linesSkipped.add(skipped);
+    m_metrics.linesRejected.add(responses.size() - skipped - m_batch.size());
+    if (!m_batch.empty())
     {
-        m_data->update(std::move(ac));
+        m_aircraftData->enqueue(m_batch);
     }
     return true;
 }
@@ -70,4 +127,49 @@ std::string AprscFeed::get_login() const
     return m_properties.get_property(KV_KEY_LOGIN);
 }
 
+std::string AprscFeed::get_filter()
+{
+    if (!m_autoFilter)
+    {
+        return "";
+    }
+    const object::Position      position = m_gpsData->get_position();
+    std::lock_guard<std::mutex> lock(m_filterMutex);
+    if (m_filter.empty() ||
+        math::distance(m_filterCenter.latitude, m_filterCenter.longitude, position.latitude,
+                       position.longitude) > AF_FILTER_MARGIN)
+    {
+        m_filterCenter = position;
+        m_filter       = makeFilter(position);
+    }
+    return m_filter;
+}
+
+bool AprscFeed::hasFilter() const
+{
+    return m_autoFilter;
+}
+
+std::string AprscFeed::makeFilter(const object::Position& position) const
+{
+    std::string filter("filter");
+    if (m_filterRange > 0)
+    {
+        char range[64];
+        std::snprintf(range, sizeof(range), " r/%.4f/%.4f/%lld", position.latitude,
+                      position.longitude, static_cast<long long>(m_filterRange));
+        filter += range;
+    }
+    if (!m_filterTerms.empty())
+    {
+        filter += " " + m_filterTerms;
+    }
+    return filter;
+}
+
+bool AprscFeed::classify(util::StringView line) const
+{
+    return parser::classifyAprs(line) == parser::LineType::AIRCRAFT;
+}
+
 }  // namespace feed
@@ -25,8 +25,10 @@
 
 #include "config/Configuration.h"
 #include "data/AtmosphereData.h"
+#include "feed/parser/Classifier.h"
 #include "feed/parser/AtmosphereParser.h"
 #include "object/Atmosphere.h"
+#include "util/Metrics.h"
 
 #ifdef COMPONENT
 #    undef COMPONENT
@@ -52,9 +54,20 @@ bool AtmosphereFeed::process(const std::string& response)
     object::Atmosphere atmos(get_priority());
     if (s_parser.unpack(response, atmos))
     {
+        parsed(1);
+        tag(atmos);
         m_data->update(std::move(atmos));
     }
+    else
+    {
+        m_metrics.linesRejected.add();
+    }
     return true;
 }
 
+bool AtmosphereFeed::classify(util::StringView line) const
+{
+    return parser::isNmea(line, "MDA");
+}
+
 }  // namespace feed
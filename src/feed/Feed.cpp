@@ -28,7 +28,9 @@
 
 #include "config/Configuration.h"
 #include "data/Data.hpp"
+#include "object/Object.h"
 #include "util/Logger.hpp"
+#include "util/Metrics.h"
 
 using namespace config;
 
@@ -36,7 +38,11 @@ namespace feed
 {
 Feed::Feed(const std::string& name, const char* component, const Properties& properties,
            std::shared_ptr<data::Data> data)
-    : m_name(name), m_component(component), m_properties(properties), m_data(data)
+    : m_name(name),
+      m_component(component),
+      m_properties(properties),
+      m_data(data),
+      m_metrics(metrics.feed(name))
 {
     initPriority();
     if (m_properties.get_property(KV_KEY_HOST).empty())
@@ -51,6 +57,44 @@ Feed::Feed(const std::string& name, const char* component, const Properties& pro
     }
 }
 
+bool Feed::processBatch(const std::vector<util::StringView>& responses)
+{
+    for (const auto& it : responses)
+    {
+        if (!classify(it))
+        {
+            m_metrics.linesSkipped.add();
+            continue;
+        }
+        m_response.assign(it.data(), it.size());
+        if (!process(m_response))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Feed::tag(object::Object& object) const
+{
+    object.set_metrics(&m_metrics);
+    object.set_received(m_received);
+}
+
+bool Feed::classify(util::StringView) const
+{
+    return true;
+}
+
+void Feed::parsed(std::size_t count)
+{
+    m_metrics.linesParsed.add(count);
+    if (count > 0 && m_received.time_since_epoch().count() != 0)
+    {
+        m_metrics.parseLatency.observe(std::chrono::steady_clock::now() - m_received, count);
+    }
+}
+
 void Feed::initPriority() noexcept
 {
     try
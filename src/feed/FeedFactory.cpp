@@ -52,7 +52,8 @@ template<>
 std::shared_ptr<AprscFeed> FeedFactory::makeFeed<AprscFeed>(const std::string& name)
 {
     return std::make_shared<AprscFeed>(name, m_config->get_feedProperties().at(name),
-                                       m_aircraftData, m_config->get_maxHeight());
+                                       m_aircraftData, m_config->get_maxHeight(), m_gpsData,
+                                       m_config->get_maxDistance());
 }
 
 template<>
@@ -26,9 +26,11 @@
 
 #include "config/Configuration.h"
 #include "data/GpsData.h"
+#include "feed/parser/Classifier.h"
 #include "feed/parser/GpsParser.h"
 #include "object/GpsPosition.h"
 #include "util/Logger.hpp"
+#include "util/Metrics.h"
 
 #ifdef COMPONENT
 #    undef COMPONENT
@@ -54,9 +56,11 @@ bool GpsFeed::process(const std::string& response)
     object::GpsPosition pos(get_priority());
     if (s_parser.unpack(response, pos))
     {
+        parsed(1);
+        tag(pos);
         try
         {
-            m_data->update(std::move(pos));
+            m_data->enqueue(std::move(pos));
         }
         catch (const data::GpsDataException& e)
         {
@@ -64,7 +68,16 @@ bool GpsFeed::process(const std::string& response)
             return false;
         }
     }
+    else
+    {
+        m_metrics.linesRejected.add();
+    }
     return true;
 }
 
+bool GpsFeed::classify(util::StringView line) const
+{
+    return parser::isNmea(line, "GGA");
+}
+
 }  // namespace feed
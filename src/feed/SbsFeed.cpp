@@ -25,8 +25,10 @@
 
 #include "config/Configuration.h"
 #include "data/AircraftData.h"
+#include "feed/parser/Classifier.h"
 #include "feed/parser/SbsParser.h"
 #include "object/Aircraft.h"
+#include "util/Metrics.h"
 
 #ifdef COMPONENT
 #    undef COMPONENT
@@ -39,7 +41,7 @@ parser::SbsParser SbsFeed::s_parser;
 
 SbsFeed::SbsFeed(const std::string& name, const config::Properties& properties,
                  std::shared_ptr<data::AircraftData> data, std::int32_t maxHeight)
-    : Feed(name, COMPONENT, properties, data)
+    : Feed(name, COMPONENT, properties, data), m_aircraftData(data)
 {
     parser::SbsParser::s_maxHeight = maxHeight;
 }
@@ -51,12 +53,43 @@ Feed::Protocol SbsFeed::get_protocol() const
 
 bool SbsFeed::process(const std::string& response)
 {
-    object::Aircraft ac(get_priority());
-    if (s_parser.unpack(response, ac))
+    return processBatch({util::StringView(response)});
+}
+
+bool SbsFeed::processBatch(const std::vector<util::StringView>& responses)
+{
+    std::size_t skipped = 0;
+    m_batch.clear();
+    for (const auto& it : responses)
+    {
+        if (!classify(it))
+        {
+            ++skipped;
+            continue;
+        }
+        m_batch.emplace_back(get_priority());
+        if (!s_parser.unpackView(it, m_batch.back()))
+        {
+            m_batch.pop_back();
+        }
+        else
+        {
+            tag(m_batch.back());
+        }
+    }
+    parsed(m_batch.size());
+    m_metrics.linesSkipped.add(skipped);
+    m_metrics.linesRejected.add(responses.size() - skipped - m_batch.size());
+    if (!m_batch.empty())
     {
-        m_data->update(std::move(ac));
+        m_aircraftData->enqueue(m_batch);
     }
     return true;
 }
 
+bool SbsFeed::classify(util::StringView line) const
+{
+    return parser::isSbsPosition(line);
+}
+
 }  // namespace feed
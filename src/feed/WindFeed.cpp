@@ -25,8 +25,10 @@
 
 #include "config/Configuration.h"
 #include "data/WindData.h"
+#include "feed/parser/Classifier.h"
 #include "feed/parser/WindParser.h"
 #include "object/Wind.h"
+#include "util/Metrics.h"
 
 #ifdef COMPONENT
 #    undef COMPONENT
@@ -52,9 +54,20 @@ bool WindFeed::process(const std::string& response)
     object::Wind wind(get_priority());
     if (s_parser.unpack(response, wind))
     {
+        parsed(1);
+        tag(wind);
         m_data->update(std::move(wind));
     }
+    else
+    {
+        m_metrics.linesRejected.add();
+    }
     return true;
 }
 
+bool WindFeed::classify(util::StringView line) const
+{
+    return parser::isNmea(line, "MWV");
+}
+
 }  // namespace feed
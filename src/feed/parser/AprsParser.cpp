@@ -21,6 +21,7 @@
 
 #include "feed/parser/AprsParser.h"
 
+#include <cstddef>
 #include <limits>
 #include <stdexcept>
 
@@ -87,6 +88,225 @@ using namespace object;
 
 namespace parser
 {
+namespace
+{
+/**
+ * @brief Positions of the fields in an APRS sentence.
+ */
+struct AprsFields
+{
+    /// Begin of time
+    std::size_t time = 0;
+
+    /// Begin of latitude
+    std::size_t latitude = 0;
+
+    /// Begin of longitude
+    std::size_t longitude = 0;
+
+    /// Begin of heading and ground speed; npos if not available
+    std::size_t course = util::StringView::npos;
+
+    /// Begin of altitude
+    std::size_t altitude = 0;
+
+    /// Begin of comment
+    std::size_t comment = 0;
+};
+
+/**
+ * @brief Get the upper case of an ASCII character.
+ * @param c The character
+ * @return the upper case character
+ */
+inline char toUpper(char c)
+{
+    return (c >= 'a' && c <= 'z') ? static_cast<char>(c - ('a' - 'A')) : c;
+}
+
+/**
+ * @brief Check whether an upper case literal is found at a position, case insensitive.
+ * @param str   The string
+ * @param pos   The position
+ * @param upper The upper case literal
+ * @return true if yes, else false
+ */
+inline bool matchesAt(util::StringView str, std::size_t pos, const char* upper)
+{
+    for (std::size_t i = 0; upper[i] != '\0'; ++i)
+    {
+        if (pos + i >= str.size() || toUpper(str[pos + i]) != upper[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Check for all decimal digits in a range.
+ * @param str The string
+ * @param pos The position
+ * @param len The amount of digits
+ * @return true if yes, else false
+ */
+inline bool digitsAt(util::StringView str, std::size_t pos, std::size_t len)
+{
+    if (pos + len > str.size())
+    {
+        return false;
+    }
+    for (std::size_t i = pos; i < pos + len; ++i)
+    {
+        if (!util::isDigit(str[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Check for a degree-minute value (d{len}.dd) followed by one of two orientations.
+ * @param str  The string
+ * @param pos  The position
+ * @param len  The amount of integer digits
+ * @param dirs The two possible orientations, upper case
+ * @return true if yes, else false
+ */
+inline bool degMinAt(util::StringView str, std::size_t pos, std::size_t len, const char* dirs)
+{
+    return digitsAt(str, pos, len) && pos + len + 3 < str.size() && str[pos + len] == '.' &&
+           digitsAt(str, pos + len + 1, 2) &&
+           (toUpper(str[pos + len + 3]) == dirs[0] || toUpper(str[pos + len + 3]) == dirs[1]);
+}
+
+/**
+ * @brief Get the value of a degree-minute field (d{len}.dd).
+ * @param str The first digit
+ * @param len The amount of integer digits
+ * @return the degree-minute value
+ */
+inline double degMinValue(const char* str, std::size_t len)
+{
+    std::uint32_t intPart = 0, fracPart = 0;
+    util::parseDigits(str, len, intPart);
+    util::parseDigits(str + len + 1, 2, fracPart);
+    return static_cast<double>(intPart * 100 + fracPart) / 100.0;
+}
+
+/**
+ * @brief Match the altitude (/A=dddddd) followed by at least one whitespace and a comment.
+ * @param str    The string
+ * @param pos    The position
+ * @param fields The fields to fill
+ * @return true on success, else false
+ */
+inline bool matchAltitude(util::StringView str, std::size_t pos, AprsFields& fields)
+{
+    if (str.size() > pos + 10 && str[pos] == '/' && toUpper(str[pos + 1]) == 'A' &&
+        str[pos + 2] == '=' && digitsAt(str, pos + 3, 6) && util::isSpace(str[pos + 9]))
+    {
+        fields.altitude = pos + 3;
+        fields.comment  = pos + 10;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Match the optional course (ddd/ddd) and altitude at the earliest possible position.
+ * @param str    The string
+ * @param pos    The position to start at
+ * @param fields The fields to fill
+ * @return true on success, else false
+ */
+inline bool matchCourseAltitude(util::StringView str, std::size_t pos, AprsFields& fields)
+{
+    for (; pos < str.size(); ++pos)
+    {
+        if (digitsAt(str, pos, 3) && str.size() > pos + 7 && str[pos + 3] == '/' &&
+            digitsAt(str, pos + 4, 3) && matchAltitude(str, pos + 7, fields))
+        {
+            fields.course = pos;
+            return true;
+        }
+        if (matchAltitude(str, pos, fields))
+        {
+            fields.course = util::StringView::npos;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Match the position report, beginning after ":/".
+ * @param str    The string
+ * @param pos    The position of time
+ * @param fields The fields to fill
+ * @return true on success, else false
+ */
+inline bool matchPosition(util::StringView str, std::size_t pos, AprsFields& fields)
+{
+    if (!(digitsAt(str, pos, 6) && pos + 6 < str.size() && toUpper(str[pos + 6]) == 'H' &&
+          degMinAt(str, pos + 7, 4, "NS")))
+    {
+        return false;
+    }
+    fields.time     = pos;
+    fields.latitude = pos + 7;
+    // skip at least the symbol table identifier
+    for (std::size_t lon = pos + 16; lon < str.size(); ++lon)
+    {
+        if (degMinAt(str, lon, 5, "EW") && matchCourseAltitude(str, lon + 10, fields))
+        {
+            fields.longitude = lon;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Match the whole sentence: source>APRS,path:/position.
+ * @param str    The string
+ * @param fields The fields to fill
+ * @return true on success, else false
+ */
+inline bool matchSentence(util::StringView str, AprsFields& fields)
+{
+    for (std::size_t i = 1; i < str.size() && !util::isSpace(str[i - 1]); ++i)
+    {
+        if (str[i] == '>' && matchesAt(str, i + 1, "APRS,"))
+        {
+            // the path contains at least one character
+            for (std::size_t p = i + 7; p + 1 < str.size() && !util::isSpace(str[p - 1]); ++p)
+            {
+                if (str[p] == ':' && str[p + 1] == '/' && matchPosition(str, p + 2, fields))
+                {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Check for the OGN id field (idXXYYYYYY) at a position.
+ * @param str The string
+ * @param pos The position
+ * @return true if yes, else false
+ */
+inline bool idAt(util::StringView str, std::size_t pos)
+{
+    std::uint32_t dummy;
+    return pos + 10 <= str.size() && matchesAt(str, pos, "ID") &&
+           util::parseHexDigits(str.data() + pos + 2, 8, dummy);
+}
+}  // namespace
+
 const boost::regex AprsParser::s_APRS_RE(
     "^(?:\\S+?)>APRS,\\S+?(?:,\\S+?)?:/(\\d{6})h(\\d{4}\\.\\d{2})([NS])[\\S\\s]+?(\\d{5}\\.\\d{2})([EW])[\\S\\s]+?(?:(\\d{3})/(\\d{3}))?/A=(\\d{6})\\s+?([\\S\\s]+?)$",
     boost::regex::optimize | boost::regex::icase);
@@ -100,11 +320,114 @@ std::int32_t AprsParser::s_maxHeight = std::numeric_limits<std::int32_t>::max();
 AprsParser::AprsParser() : Parser<Aircraft>() {}
 
 bool AprsParser::unpack(const std::string& sentence, Aircraft& aircraft) noexcept
+{
+    return unpackView(util::StringView(sentence), aircraft);
+}
+
+bool AprsParser::unpackView(util::StringView sentence, Aircraft& aircraft,
+                            bool regexFallback) noexcept
+{
+    if (sentence.empty() || sentence.front() == '#')
+    {
+        return false;
+    }
+    return tokenize(sentence, aircraft) ||
+           (regexFallback &&
+            unpackRegex(std::string(sentence.data(), sentence.size()), aircraft));
+}
+
+bool AprsParser::tokenize(util::StringView sentence, Aircraft& aircraft) noexcept
+{
+    AprsFields fields;
+    if (!matchSentence(sentence, fields))
+    {
+        return false;
+    }
+    const char* str = sentence.data();
+
+    // position
+    Position      pos;
+    std::uint32_t value = 0;
+    pos.latitude        = math::dmToDeg(degMinValue(str + fields.latitude, 4));
+    if (str[fields.latitude + 7] == 'S')
+    {
+        pos.latitude = -pos.latitude;
+    }
+    pos.longitude = math::dmToDeg(degMinValue(str + fields.longitude, 5));
+    if (str[fields.longitude + 8] == 'W')
+    {
+        pos.longitude = -pos.longitude;
+    }
+    util::parseDigits(str + fields.altitude, 6, value);
+    pos.altitude = math::doubleToInt(static_cast<double>(value) * math::FEET_2_M);
+    aircraft.set_position(pos);
+    if (pos.altitude > s_maxHeight)
+    {
+        return false;
+    }
+
+    // timestamp
+    TimeStamp<timestamp::DateTimeImplBoost> timeStamp;
+    if (!TimeStamp<timestamp::DateTimeImplBoost>::tryParse(
+            util::StringView(str + fields.time, 6), timestamp::Format::HHMMSS, timeStamp))
+    {
+        return false;
+    }
+    aircraft.set_timeStamp(timeStamp);
+
+    // comment; an id at the very beginning is the last resort
+    std::size_t id = fields.comment + 1;
+    while (id < sentence.size() && !idAt(sentence, id))
+    {
+        ++id;
+    }
+    if (id >= sentence.size())
+    {
+        if (!idAt(sentence, fields.comment))
+        {
+            return false;
+        }
+        id = fields.comment;
+    }
+    std::uint32_t address = 0;
+    util::parseHexDigits(str + id + 2, 2, value);
+    util::parseHexDigits(str + id + 4, 6, address);
+    aircraft.set_id(address);
+    aircraft.set_idType(static_cast<Aircraft::IdType>(value & 0x03));
+    aircraft.set_aircraftType(static_cast<Aircraft::AircraftType>((value & 0x7C) >> 2));
+
+    // movement
+    std::size_t climb = id + 10;
+    if (climb < sentence.size() && util::isSpace(str[climb]))
+    {
+        ++climb;
+    }
+    bool fullInfo = fields.course != util::StringView::npos && climb + 7 < sentence.size() &&
+                    (str[climb] == '+' || str[climb] == '-') && digitsAt(sentence, climb + 1, 3) &&
+                    matchesAt(sentence, climb + 4, "FPM") && util::isSpace(str[climb + 7]);
+    if (fullInfo)
+    {
+        Movement move;
+        util::parseDigits(str + fields.course, 3, value);
+        move.heading = static_cast<double>(value);
+        util::parseDigits(str + fields.course + 4, 3, value);
+        move.gndSpeed = static_cast<double>(value) * math::KTS_2_MS;
+        util::parseDigits(str + climb + 1, 3, value);
+        move.climbRate = (str[climb] == '-' ? -static_cast<double>(value) :
+                                              static_cast<double>(value)) *
+                         math::FPM_2_MS;
+        aircraft.set_movement(move);
+    }
+    aircraft.set_fullInfo(fullInfo);
+    aircraft.set_targetType(Aircraft::TargetType::FLARM);
+    return true;
+}
+
+bool AprsParser::unpackRegex(const std::string& sentence, Aircraft& aircraft) noexcept
 {
     boost::smatch match, com_match;
 
-    if ((!sentence.empty() && sentence.front() == '#') ||
-        !(boost::regex_match(sentence, match, s_APRS_RE) && parsePosition(match, aircraft) &&
+    if (!(boost::regex_match(sentence, match, s_APRS_RE) && parsePosition(match, aircraft) &&
           parseTimeStamp(match, aircraft)))
     {
         return false;
@@ -148,9 +471,10 @@ bool AprsParser::parsePosition(const boost::smatch& match, Aircraft& aircraft) n
 
 bool AprsParser::parseComment(const boost::smatch& match, Aircraft& aircraft) noexcept
 {
-    aircraft.set_id(match.str(RE_APRS_COM_ID));
     try
     {
+        aircraft.set_id(
+            static_cast<std::uint32_t>(std::stoul(match.str(RE_APRS_COM_ID), nullptr, 16)));
         aircraft.set_idType(static_cast<Aircraft::IdType>(
             std::stoi(match.str(RE_APRS_COM_TYPE), nullptr, 16) & 0x03));
         aircraft.set_aircraftType(static_cast<Aircraft::AircraftType>(
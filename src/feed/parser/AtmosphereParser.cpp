@@ -24,6 +24,7 @@
 #include <cstddef>
 #include <stdexcept>
 
+#include "feed/parser/Classifier.h"
 #include "util/math.hpp"
 
 namespace feed
@@ -34,11 +35,14 @@ AtmosphereParser::AtmosphereParser() : Parser<object::Atmosphere>() {}
 
 bool AtmosphereParser::unpack(const std::string& sentence, object::Atmosphere& atmosphere) noexcept
 {
+    if (!isNmea(util::StringView(sentence), "MDA"))
+    {
+        return false;
+    }
     try
     {
-        if ((std::stoi(sentence.substr(sentence.rfind('*') + 1, 2), nullptr, 16) ==
-             math::checksum(sentence.c_str(), sentence.length())) &&
-            (sentence.find("MDA") != std::string::npos))
+        if (std::stoi(sentence.substr(sentence.rfind('*') + 1, 2), nullptr, 16) ==
+            math::checksum(sentence.c_str(), sentence.length()))
         {
             bool        valid  = false;
             std::size_t tmpB   = sentence.find('B') - 1;
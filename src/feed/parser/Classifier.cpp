@@ -0,0 +1,214 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include "feed/parser/Classifier.h"
+
+#include <cstddef>
+#include <cstring>
+
+#if defined(__GNUC__) && defined(__SSE2__)
+#    include <immintrin.h>
+#endif
+
+namespace feed
+{
+namespace parser
+{
+namespace
+{
+/// Amount of markers of an aircraft report, in order: >, :/, /A=, id
+constexpr std::size_t MARKERS = 4;
+
+/// Length of each marker
+constexpr std::size_t MARKER_LEN[MARKERS] = {1, 2, 3, 2};
+
+/**
+ * @brief Check the bytes following a candidate marker, that are not part of the search.
+ * @param line   The line
+ * @param pos    The position of the marker
+ * @param marker The marker index
+ * @return true if valid, else false
+ */
+inline bool validAt(util::StringView line, std::size_t pos, std::size_t marker)
+{
+    // position reports have a timestamp (hhmmss followed by h)
+    return marker != 1 || (pos + 8 < line.size() && (line[pos + 8] | 0x20) == 'h');
+}
+
+/**
+ * @brief Check for a marker at a position.
+ * @param line   The line
+ * @param pos    The position
+ * @param marker The marker index
+ * @return true if found, else false
+ */
+inline bool markerAt(util::StringView line, std::size_t pos, std::size_t marker)
+{
+    if (pos + MARKER_LEN[marker] > line.size())
+    {
+        return false;
+    }
+    const char* s = line.data() + pos;
+    switch (marker)
+    {
+        case 0: return s[0] == '>';
+        case 1: return s[0] == ':' && s[1] == '/';
+        case 2: return s[0] == '/' && (s[1] | 0x20) == 'a' && s[2] == '=';
+        default: return (s[0] | 0x20) == 'i' && (s[1] | 0x20) == 'd';
+    }
+}
+
+#if defined(__GNUC__)
+/// Amount of bytes searched at once
+constexpr std::size_t BLOCK = 16;
+
+/// @typedef Bytes
+/// Block of bytes, comparisons yield all bits set in true lanes
+using Bytes = std::int8_t __attribute__((vector_size(BLOCK)));
+
+/**
+ * @brief Load a block from memory.
+ * @param src The first byte
+ * @return the block
+ */
+inline Bytes load(const char* src)
+{
+    Bytes block;
+    std::memcpy(&block, src, sizeof(block));
+    return block;
+}
+
+/**
+ * @brief Get a block with all bytes set to a value.
+ * @param value The value
+ * @return the block
+ */
+inline Bytes splat(char value)
+{
+    return Bytes{} + static_cast<std::int8_t>(value);
+}
+
+/**
+ * @brief Collect the lanes of a comparison into bits.
+ * @param mask The comparison result
+ * @return the bits, lowest for the first byte
+ */
+inline std::uint32_t bits(Bytes mask)
+{
+#    if defined(__SSE2__)
+    __m128i v;
+    std::memcpy(&v, &mask, sizeof(v));
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(v));
+#    else
+    std::uint32_t result = 0;
+    for (std::size_t i = 0; i < BLOCK; ++i)
+    {
+        result |= static_cast<std::uint32_t>(mask[i] != 0) << i;
+    }
+    return result;
+#    endif
+}
+
+/**
+ * @brief Search all markers in a block, where the block plus 2 bytes are readable.
+ * @param src   The first byte
+ * @param found The bits of the positions per marker
+ */
+inline void searchBlock(const char* src, std::uint32_t (&found)[MARKERS])
+{
+    const Bytes b0 = load(src);
+    const Bytes b1 = load(src + 1);
+    const Bytes b2 = load(src + 2);
+    const Bytes l0 = b0 | splat(0x20);
+    const Bytes l1 = b1 | splat(0x20);
+    found[0]       = bits(b0 == splat('>'));
+    found[1]       = bits((b0 == splat(':')) & (b1 == splat('/')));
+    found[2]       = bits((b0 == splat('/')) & (l1 == splat('a')) & (b2 == splat('=')));
+    found[3]       = bits((l0 == splat('i')) & (l1 == splat('d')));
+}
+#endif
+}  // namespace
+
+LineType classifyAprs(util::StringView line) noexcept
+{
+    if (line.empty())
+    {
+        return LineType::GARBAGE;
+    }
+    if (line.front() == '#')
+    {
+        return LineType::COMMENT;
+    }
+    std::size_t marker = 0;
+    std::size_t from   = 0;
+    std::size_t pos    = 0;
+#if defined(__GNUC__)
+    for (; marker < MARKERS && pos + BLOCK + 2 <= line.size(); pos += BLOCK)
+    {
+        std::uint32_t found[MARKERS];
+        searchBlock(line.data() + pos, found);
+        while (marker < MARKERS)
+        {
+            // markers must not overlap the previous one, which ends at most 2 bytes past the block
+            const std::uint32_t candidates =
+                from > pos ? found[marker] & (~0U << (from - pos)) : found[marker];
+            if (candidates == 0)
+            {
+                break;
+            }
+            const std::size_t at = pos + static_cast<std::size_t>(__builtin_ctz(candidates));
+            if (validAt(line, at, marker))
+            {
+                from = at + MARKER_LEN[marker++];
+            }
+            else
+            {
+                from = at + 1;
+            }
+        }
+    }
+#endif
+    for (pos = pos > from ? pos : from; marker < MARKERS && pos < line.size(); ++pos)
+    {
+        if (markerAt(line, pos, marker) && validAt(line, pos, marker))
+        {
+            pos += MARKER_LEN[marker++] - 1;
+        }
+    }
+    if (marker == MARKERS)
+    {
+        return LineType::AIRCRAFT;
+    }
+    return marker == 0 ? LineType::GARBAGE : LineType::BEACON;
+}
+
+bool isSbsPosition(util::StringView line) noexcept
+{
+    return line.size() >= 6 && std::memcmp(line.data(), "MSG,3,", 6) == 0;
+}
+
+bool isNmea(util::StringView line, const char* type) noexcept
+{
+    return line.size() >= 7 && line[0] == '$' && std::memcmp(line.data() + 3, type, 3) == 0 &&
+           line[6] == ',';
+}
+}  // namespace parser
+}  // namespace feed
@@ -26,6 +26,7 @@
 
 #include "object/TimeStamp.hpp"
 #include "object/impl/DateTimeImplBoost.h"
+#include "feed/parser/Classifier.h"
 #include "util/math.hpp"
 
 /// @def RE_GGA_TIME
@@ -82,6 +83,10 @@ GpsParser::GpsParser() : Parser<GpsPosition>() {}
 
 bool GpsParser::unpack(const std::string& sentence, GpsPosition& position) noexcept
 {
+    if (!isNmea(util::StringView(sentence), "GGA"))
+    {
+        return false;
+    }
     try
     {
         boost::smatch match;
@@ -22,8 +22,8 @@
 #include "feed/parser/SbsParser.h"
 
 #include <cstddef>
+#include <cstring>
 #include <limits>
-#include <stdexcept>
 
 #include "object/GpsPosition.h"
 #include "util/math.hpp"
@@ -60,17 +60,24 @@ SbsParser::SbsParser() : Parser<Aircraft>() {}
 
 bool SbsParser::unpack(const std::string& sentence, Aircraft& aircraft) noexcept
 {
-    std::size_t   p = 6, delim;
+    return unpackView(util::StringView(sentence), aircraft);
+}
+
+bool SbsParser::unpackView(util::StringView sentence, Aircraft& aircraft) noexcept
+{
     std::uint32_t i = 2;
     Position      pos;
 
-    if (sentence.find(',', p) == std::string::npos || !(sentence.size() > 4 && sentence[4] == '3'))
+    if (sentence.substr(0, 6) != "MSG,3,")
     {
         return false;
     }
-    while ((delim = sentence.find(',', p)) != std::string::npos && i < 16)
+    const char* p   = sentence.data() + 6;
+    const char* end = sentence.data() + sentence.size();
+    const char* delim;
+    while (i < 16 && (delim = static_cast<const char*>(std::memchr(p, ',', end - p))) != nullptr)
     {
-        if (!parseField(i++, sentence.substr(p, delim - p), pos, aircraft))
+        if (!parseField(i++, util::StringView(p, delim - p), pos, aircraft))
         {
             return false;
         }
@@ -83,29 +90,39 @@ bool SbsParser::unpack(const std::string& sentence, Aircraft& aircraft) noexcept
     return i == 16 && pos.altitude <= s_maxHeight;
 }
 
-bool SbsParser::parseField(std::uint32_t fieldNr, const std::string& field, Position& position,
+bool SbsParser::parseField(std::uint32_t fieldNr, util::StringView field, Position& position,
                            Aircraft& aircraft) noexcept
 {
-    try
-    {
-        switch (fieldNr)
-        {
-            case SBS_FIELD_ID: aircraft.set_id(field); break;
-            case SBS_FIELD_TIME:
-                aircraft.set_timeStamp(TimeStamp<timestamp::DateTimeImplBoost>(
-                    field, timestamp::Format::HH_MM_SS_FFF));
-                break;
-            case SBS_FIELD_ALT:
-                position.altitude = math::doubleToInt(std::stod(field) * math::FEET_2_M);
-                break;
-            case SBS_FIELD_LAT: position.latitude = std::stod(field); break;
-            case SBS_FIELD_LON: position.longitude = std::stod(field); break;
-            default: break;
-        }
-    }
-    catch (const std::logic_error&)
+    double                                  value;
+    std::uint32_t                           address;
+    TimeStamp<timestamp::DateTimeImplBoost> timeStamp;
+    switch (fieldNr)
     {
-        return false;
+        case SBS_FIELD_ID:
+            if (field.size() != 6 || !util::parseHexDigits(field.data(), 6, address))
+            {
+                return false;
+            }
+            aircraft.set_id(address);
+            break;
+        case SBS_FIELD_TIME:
+            if (!TimeStamp<timestamp::DateTimeImplBoost>::tryParse(
+                    field, timestamp::Format::HH_MM_SS_FFF, timeStamp))
+            {
+                return false;
+            }
+            aircraft.set_timeStamp(timeStamp);
+            break;
+        case SBS_FIELD_ALT:
+            if (!util::parseDecimal(field, value))
+            {
+                return false;
+            }
+            position.altitude = math::doubleToInt(value * math::FEET_2_M);
+            break;
+        case SBS_FIELD_LAT: return util::parseDecimal(field, position.latitude);
+        case SBS_FIELD_LON: return util::parseDecimal(field, position.longitude);
+        default: break;
     }
     return true;
 }
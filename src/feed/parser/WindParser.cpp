@@ -23,6 +23,7 @@
 
 #include <stdexcept>
 
+#include "feed/parser/Classifier.h"
 #include "util/math.hpp"
 
 namespace feed
@@ -33,11 +34,14 @@ WindParser::WindParser() : Parser<object::Wind>() {}
 
 bool WindParser::unpack(const std::string& sentence, object::Wind& wind) noexcept
 {
+    if (!isNmea(util::StringView(sentence), "MWV"))
+    {
+        return false;
+    }
     try
     {
-        if ((std::stoi(sentence.substr(sentence.rfind('*') + 1, 2), nullptr, 16) ==
-             math::checksum(sentence.c_str(), sentence.length())) &&
-            (sentence.find("MWV") != std::string::npos))
+        if (std::stoi(sentence.substr(sentence.rfind('*') + 1, 2), nullptr, 16) ==
+            math::checksum(sentence.c_str(), sentence.length()))
         {
             wind.set_serialized(std::string(sentence));
             return true;
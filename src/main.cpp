@@ -23,6 +23,9 @@
 #include <iostream>
 #include <memory>
 #include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <boost/program_options.hpp>
 
@@ -79,6 +82,12 @@ program_options::variables_map evalArgs(int argc, char** argv)
     cmdline_options.add_options()("config,c", program_options::value<std::string>(), "config file");
     cmdline_options.add_options()("output,o", program_options::value<std::string>(),
                                   "specify where to log");
+    cmdline_options.add_options()(
+        "replay,r", program_options::value<std::vector<std::string>>()->composing(),
+        "replay a recorded file instead of connecting a feed, as FEED=FILE; may be repeated");
+    cmdline_options.add_options()(
+        "replay-speed", program_options::value<double>()->default_value(1.0),
+        "pace of the replay; 1 for real-time, N for N times faster, 0 for as fast as possible");
     program_options::variables_map variables;
     program_options::store(program_options::parse_command_line(argc, argv, cmdline_options),
                            variables);
@@ -116,6 +125,22 @@ std::shared_ptr<Configuration> get_config(const program_options::variables_map&
             conf->set_groundMode(true);
             logger.info("(VFRB) Override ground mode: Yes");
         }
+        if (variables.count("replay"))
+        {
+            std::unordered_map<std::string, std::string> files;
+            for (const auto& it : variables["replay"].as<std::vector<std::string>>())
+            {
+                std::size_t sep = it.find('=');
+                if (sep == std::string::npos || sep == 0 || sep + 1 == it.size())
+                {
+                    throw std::logic_error("invalid replay " + it + ", expected FEED=FILE");
+                }
+                files[it.substr(0, sep)] = it.substr(sep + 1);
+            }
+            conf->set_replayFiles(files);
+            conf->set_replaySpeed(variables["replay-speed"].as<double>());
+            logger.info("(VFRB) Replay recordings at speed: ", conf->get_replaySpeed());
+        }
         return conf;
     }
     else
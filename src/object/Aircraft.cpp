@@ -21,51 +21,34 @@
 
 #include "object/Aircraft.h"
 
-#include <typeinfo>
-
 namespace object
 {
 Aircraft::Aircraft() : Aircraft(0) {}
 
 Aircraft::Aircraft(std::uint32_t priority)
-    : Object(priority),
+    : Updatable(priority),
       m_idType(IdType::ICAO),
       m_aircraftType(AircraftType::POWERED_AIRCRAFT),
       m_targetType(TargetType::TRANSPONDER)
 {}
 
-void Aircraft::assign(Object&& other)
+void Aircraft::assign(Aircraft&& other)
 {
-    try
-    {
-        Aircraft&& update = dynamic_cast<Aircraft&&>(other);
-        Object::assign(std::move(other));
-        this->m_idType       = update.m_idType;
-        this->m_aircraftType = update.m_aircraftType;
-        this->m_targetType   = update.m_targetType;
-        this->m_position     = update.m_position;
-        this->m_movement     = update.m_movement;
-        this->m_timeStamp    = update.m_timeStamp;
-        this->m_fullInfo     = update.m_fullInfo;
-    }
-    catch (const std::bad_cast&)
-    {}
+    Object::assign(std::move(other));
+    this->m_idType       = other.m_idType;
+    this->m_aircraftType = other.m_aircraftType;
+    this->m_targetType   = other.m_targetType;
+    this->m_position     = other.m_position;
+    this->m_movement     = other.m_movement;
+    this->m_timeStamp    = other.m_timeStamp;
+    this->m_fullInfo     = other.m_fullInfo;
+    this->m_due          = true;
 }
 
-bool Aircraft::canUpdate(const Object& other) const
+bool Aircraft::canUpdate(const Aircraft& other) const
 {
-    try
-    {
-        const Aircraft& toUpdate = dynamic_cast<const Aircraft&>(other);
-        return (this->m_timeStamp > toUpdate.m_timeStamp) &&
-               (toUpdate.m_targetType == TargetType::TRANSPONDER ||
-                this->m_targetType == TargetType::FLARM) &&
-               Object::canUpdate(other);
-    }
-    catch (const std::bad_cast&)
-    {
-        return false;
-    }
+    return (this->m_timeStamp > other.m_timeStamp) &&
+           outranks(this->m_targetType, other.m_targetType) && Object::canUpdate(other);
 }
 
 void Aircraft::set_aircraftType(Aircraft::AircraftType type)
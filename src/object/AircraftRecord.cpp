@@ -0,0 +1,118 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include "object/AircraftRecord.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include "util/Metrics.h"
+#include "util/math.hpp"
+
+static_assert(std::is_trivially_copyable<object::AircraftRecord>::value,
+              "AircraftRecord must be trivially copyable");
+static_assert(sizeof(object::AircraftRecord) <= 64, "AircraftRecord must fit a cache line");
+
+namespace object
+{
+namespace
+{
+/**
+ * @brief Round a value to an int16, saturating at its limits.
+ * @param value The value
+ * @return the rounded value
+ */
+inline std::int16_t toInt16(double value)
+{
+    constexpr double max = std::numeric_limits<std::int16_t>::max();
+    constexpr double min = std::numeric_limits<std::int16_t>::min();
+    return static_cast<std::int16_t>(
+        math::doubleToInt(value > max ? max : (value < min || std::isnan(value) ? min : value)));
+}
+
+/// Sign bit of the climb rate
+constexpr std::uint16_t CLIMB_SIGN = 0x8000;
+
+/**
+ * @brief Round a climb rate to dm/s like printf does with one decimal, saturating at the limit.
+ * @param value The climb rate; m/s
+ * @return the magnitude, with CLIMB_SIGN set if negative
+ */
+inline std::uint16_t toClimbRate(double value)
+{
+    constexpr std::uint64_t max       = CLIMB_SIGN - 1;
+    const double            magnitude = std::isnan(value) ? 0.0 : std::fabs(value);
+    const std::uint64_t     digits =
+        magnitude * 10.0 >= max ? max : math::roundScaled(magnitude, 10.0);
+    return static_cast<std::uint16_t>(digits | (std::signbit(value) ? CLIMB_SIGN : 0));
+}
+}  // namespace
+
+AircraftRecord::AircraftRecord(const Aircraft& aircraft)
+    : m_received(aircraft.get_received()),
+      m_metrics(aircraft.get_metrics()),
+      m_timeStamp(aircraft.get_timeStamp()),
+      m_id(aircraft.get_id()),
+      m_latitude(static_cast<std::int32_t>(
+          std::lround(aircraft.get_position().latitude * AR_DEGREE_UNITS))),
+      m_longitude(static_cast<std::int32_t>(
+          std::lround(aircraft.get_position().longitude * AR_DEGREE_UNITS))),
+      m_altitude(aircraft.get_position().altitude),
+      m_lastPriority(aircraft.get_lastPriority()),
+      m_gndSpeed(toInt16(aircraft.get_movement().gndSpeed * math::MS_2_KMH)),
+      m_heading(toInt16(aircraft.get_movement().heading)),
+      m_climbRate(toClimbRate(aircraft.get_movement().climbRate)),
+      m_idType(aircraft.get_idType()),
+      m_aircraftType(aircraft.get_aircraftType()),
+      m_targetType(aircraft.get_targetType()),
+      m_updateAge(static_cast<std::uint8_t>(std::min<std::uint32_t>(
+          aircraft.get_updateAge(), std::numeric_limits<std::uint8_t>::max()))),
+      m_fullInfo(aircraft.get_fullInfo()),
+      m_due(aircraft.get_due())
+{}
+
+void AircraftRecord::countUpdate(bool accepted) const
+{
+    if (m_metrics)
+    {
+        m_metrics->countUpdate(accepted, m_received);
+    }
+}
+
+AircraftRecord& AircraftRecord::operator++()
+{
+    ++m_updateAge;
+    return *this;
+}
+
+Position AircraftRecord::get_position() const
+{
+    return {m_latitude / AR_DEGREE_UNITS, m_longitude / AR_DEGREE_UNITS, m_altitude};
+}
+
+double AircraftRecord::get_climbRate() const
+{
+    const double magnitude = (m_climbRate & ~CLIMB_SIGN) / 10.0;
+    return (m_climbRate & CLIMB_SIGN) != 0 ? -magnitude : magnitude;
+}
+}  // namespace object
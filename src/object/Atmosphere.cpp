@@ -17,28 +17,20 @@
 
 #include "object/Atmosphere.h"
 
-#include <typeinfo>
-
 namespace object
 {
-Atmosphere::Atmosphere() : Object() {}
+Atmosphere::Atmosphere() : Updatable() {}
 
-Atmosphere::Atmosphere(std::uint32_t priority) : Object(priority) {}
+Atmosphere::Atmosphere(std::uint32_t priority) : Updatable(priority) {}
 
 Atmosphere::Atmosphere(double pressure, std::uint32_t priority)
-    : Object(priority), m_pressure(pressure)
+    : Updatable(priority), m_pressure(pressure)
 {}
 
-void Atmosphere::assign(Object&& other)
+void Atmosphere::assign(Atmosphere&& other)
 {
-    try
-    {
-        Atmosphere&& update = dynamic_cast<Atmosphere&&>(other);
-        Object::assign(std::move(other));
-        this->m_pressure = update.m_pressure;
-    }
-    catch (const std::bad_cast&)
-    {}
+    Object::assign(std::move(other));
+    this->m_pressure = other.m_pressure;
 }
 
 }  // namespace object
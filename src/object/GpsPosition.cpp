@@ -17,46 +17,30 @@
 
 #include "object/GpsPosition.h"
 
-#include <typeinfo>
-
 namespace object
 {
-GpsPosition::GpsPosition() : Object() {}
+GpsPosition::GpsPosition() : Updatable() {}
 
-GpsPosition::GpsPosition(std::uint32_t priority) : Object(priority) {}
+GpsPosition::GpsPosition(std::uint32_t priority) : Updatable(priority) {}
 
 GpsPosition::GpsPosition(const Position& position, double geoid)
-    : Object(), m_position(position), m_geoid(geoid)
+    : Updatable(), m_position(position), m_geoid(geoid)
 {}
 
-void GpsPosition::assign(Object&& other)
+void GpsPosition::assign(GpsPosition&& other)
 {
-    try
-    {
-        GpsPosition&& update = dynamic_cast<GpsPosition&&>(other);
-        Object::assign(std::move(other));
-        this->m_position       = update.m_position;
-        this->m_timeStamp      = update.m_timeStamp;
-        this->m_nrOfSatellites = update.m_nrOfSatellites;
-        this->m_fixQuality     = update.m_fixQuality;
-        this->m_geoid          = update.m_geoid;
-        this->m_dilution       = update.m_dilution;
-    }
-    catch (const std::bad_cast&)
-    {}
+    Object::assign(std::move(other));
+    this->m_position       = other.m_position;
+    this->m_timeStamp      = other.m_timeStamp;
+    this->m_nrOfSatellites = other.m_nrOfSatellites;
+    this->m_fixQuality     = other.m_fixQuality;
+    this->m_geoid          = other.m_geoid;
+    this->m_dilution       = other.m_dilution;
 }
 
-bool GpsPosition::canUpdate(const Object& other) const
+bool GpsPosition::canUpdate(const GpsPosition& other) const
 {
-    try
-    {
-        const GpsPosition& toUpdate = dynamic_cast<const GpsPosition&>(other);
-        return (this->m_timeStamp > toUpdate.m_timeStamp) && Object::canUpdate(other);
-    }
-    catch (const std::bad_cast&)
-    {
-        return false;
-    }
+    return (this->m_timeStamp > other.m_timeStamp) && Object::canUpdate(other);
 }
 
 }  // namespace object
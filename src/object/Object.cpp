@@ -17,6 +17,8 @@
 
 #include "object/Object.h"
 
+#include "util/Metrics.h"
+
 namespace object
 {
 Object::Object(std::uint32_t priority) : m_lastPriority(priority) {}
@@ -25,22 +27,17 @@ void Object::assign(Object&& other)
 {
     this->m_serialized   = std::move(other.m_serialized);
     this->m_lastPriority = other.m_lastPriority;
+    this->m_metrics      = other.m_metrics;
+    this->m_received     = other.m_received;
     this->m_updateAge    = 0;
 }
 
-bool Object::tryUpdate(Object&& other)
+void Object::countUpdate(bool accepted) const
 {
-    if (other.canUpdate(*this))
+    if (m_metrics)
     {
-        this->assign(std::move(other));
-        return true;
+        m_metrics->countUpdate(accepted, m_received);
     }
-    return false;
-}
-
-bool Object::canUpdate(const Object& other) const
-{
-    return this->m_lastPriority >= other.m_lastPriority || other.m_updateAge >= OBJ_OUTDATED;
 }
 
 void Object::set_serialized(std::string&& serialized)
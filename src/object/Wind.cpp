@@ -19,8 +19,8 @@
 
 namespace object
 {
-Wind::Wind() : Object() {}
+Wind::Wind() : Updatable() {}
 
-Wind::Wind(std::uint32_t priority) : Object(priority) {}
+Wind::Wind(std::uint32_t priority) : Updatable(priority) {}
 
 }  // namespace object
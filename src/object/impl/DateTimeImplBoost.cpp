@@ -27,18 +27,36 @@ namespace object
 {
 namespace timestamp
 {
+std::atomic<std::uint64_t> DateTimeImplBoost::s_clock(0);
+
 std::int64_t DateTimeImplBoost::now()
 {
-    return static_cast<std::int64_t>(
-        boost::posix_time::time_duration(
-            boost::posix_time::microsec_clock::universal_time().time_of_day())
-            .total_milliseconds());
+    return static_cast<std::int64_t>(clock() & 0xFFFFFFFF);
 }
 
 std::uint32_t DateTimeImplBoost::day()
 {
-    return static_cast<std::uint32_t>(
-        boost::posix_time::microsec_clock::universal_time().date().modjulian_day());
+    return static_cast<std::uint32_t>(clock() >> 32);
+}
+
+void DateTimeImplBoost::refresh()
+{
+    boost::posix_time::ptime utc = boost::posix_time::microsec_clock::universal_time();
+    s_clock.store(
+        (static_cast<std::uint64_t>(utc.date().modjulian_day()) << 32) |
+            static_cast<std::uint64_t>(utc.time_of_day().total_milliseconds()),
+        std::memory_order_relaxed);
+}
+
+std::uint64_t DateTimeImplBoost::clock()
+{
+    std::uint64_t value = s_clock.load(std::memory_order_relaxed);
+    if (value == 0)
+    {
+        refresh();
+        value = s_clock.load(std::memory_order_relaxed);
+    }
+    return value;
 }
 
 }  // namespace timestamp
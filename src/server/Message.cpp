@@ -0,0 +1,113 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include "server/Message.h"
+
+#include <utility>
+
+namespace server
+{
+Message::Message(const Message& other) noexcept : m_buffer(other.m_buffer)
+{
+    if (m_buffer)
+    {
+        m_buffer->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+Message::Message(Message&& other) noexcept : m_buffer(other.m_buffer)
+{
+    other.m_buffer = nullptr;
+}
+
+Message::Message(Buffer* buffer) noexcept : m_buffer(buffer)
+{
+    m_buffer->refs.store(1, std::memory_order_relaxed);
+}
+
+Message::~Message() noexcept
+{
+    if (m_buffer && m_buffer->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        auto pool = m_buffer->pool.lock();
+        if (pool)
+        {
+            pool->recycle(m_buffer);
+        }
+        else
+        {
+            delete m_buffer;
+        }
+    }
+}
+
+Message& Message::operator=(Message other) noexcept
+{
+    std::swap(m_buffer, other.m_buffer);
+    return *this;
+}
+
+const std::string& Message::get() const
+{
+    static const std::string empty;
+    return m_buffer ? m_buffer->data : empty;
+}
+
+bool Message::empty() const
+{
+    return !m_buffer || m_buffer->data.empty();
+}
+
+MessagePool::~MessagePool() noexcept {}
+
+std::shared_ptr<MessagePool> MessagePool::create()
+{
+    return std::shared_ptr<MessagePool>(new MessagePool());
+}
+
+Message MessagePool::seal(std::string& content)
+{
+    std::unique_ptr<Message::Buffer> buffer;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_free.empty())
+        {
+            buffer = std::move(m_free.back());
+            m_free.pop_back();
+        }
+    }
+    if (!buffer)
+    {
+        buffer.reset(new Message::Buffer());
+        buffer->pool = shared_from_this();
+    }
+    buffer->data.swap(content);
+    content.clear();
+    return Message(buffer.release());
+}
+
+void MessagePool::recycle(Message::Buffer* buffer) noexcept
+{
+    std::unique_ptr<Message::Buffer> owned(buffer);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_free.push_back(std::move(owned));
+}
+}  // namespace server
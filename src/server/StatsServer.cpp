@@ -0,0 +1,123 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include "server/StatsServer.h"
+
+#include <string>
+
+#include "util/Logger.hpp"
+#include "util/Metrics.h"
+
+namespace server
+{
+/**
+ * @brief A connection, answered once and closed.
+ */
+struct StatsServer::Session
+{
+    explicit Session(boost::asio::io_service& ioService) : socket(ioService) {}
+
+    /// Connection socket
+    boost::asio::ip::tcp::socket socket;
+
+    /// Request header
+    boost::asio::streambuf request;
+
+    /// Response
+    std::string response;
+};
+
+StatsServer::StatsServer(std::uint16_t port)
+    : m_acceptor(m_ioService,
+                 boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), port),
+                 boost::asio::ip::tcp::acceptor::reuse_address(true))
+{}
+
+StatsServer::~StatsServer() noexcept
+{
+    stop();
+}
+
+void StatsServer::run()
+{
+    logger.info("(StatsServer) serve metrics on 127.0.0.1:", m_acceptor.local_endpoint().port());
+    accept();
+    m_thread = std::thread([this] { m_ioService.run(); });
+}
+
+void StatsServer::stop()
+{
+    if (!m_ioService.stopped())
+    {
+        m_ioService.stop();
+    }
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+void StatsServer::accept()
+{
+    auto session = std::make_shared<Session>(m_ioService);
+    m_acceptor.async_accept(session->socket,
+                            [this, session](const boost::system::error_code& error) {
+                                handleAccept(error, session);
+                            });
+}
+
+void StatsServer::handleAccept(const boost::system::error_code& error,
+                               std::shared_ptr<Session>         session)
+{
+    if (error)
+    {
+        logger.debug("(StatsServer) accept: ", error.message());
+        if (error == boost::asio::error::operation_aborted)
+        {
+            return;
+        }
+    }
+    else
+    {
+        boost::asio::async_read_until(
+            session->socket, session->request, "\r\n\r\n",
+            [session](const boost::system::error_code& error, std::size_t) {
+                if (error)
+                {
+                    return;
+                }
+                std::string body;
+                metrics.render(body);
+                session->response = "HTTP/1.0 200 OK\r\n"
+                                    "Content-Type: text/plain; version=0.0.4\r\n"
+                                    "Content-Length: " +
+                                    std::to_string(body.size()) + "\r\n\r\n" + body;
+                boost::asio::async_write(
+                    session->socket, boost::asio::buffer(session->response),
+                    [session](const boost::system::error_code&, std::size_t) {
+                        boost::system::error_code ec;
+                        session->socket.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
+                    });
+            });
+    }
+    accept();
+}
+}  // namespace server
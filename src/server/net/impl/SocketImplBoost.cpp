@@ -21,6 +21,9 @@
 
 #include "server/net/impl/SocketImplBoost.h"
 
+#include <cstddef>
+#include <utility>
+
 #include <boost/system/error_code.hpp>
 
 #include "server/net/SocketException.h"
@@ -29,11 +32,39 @@ namespace server
 {
 using namespace net;
 
-SocketImplBoost::SocketImplBoost(SocketImplBoost&& other) : m_socket(boost::move(other.m_socket)) {}
+namespace
+{
+/**
+ * @brief View on buffers, which does not copy them along with the write operation.
+ */
+struct BufferView
+{
+    using value_type     = boost::asio::const_buffer;
+    using const_iterator = const boost::asio::const_buffer*;
+
+    const_iterator begin() const
+    {
+        return first;
+    }
+
+    const_iterator end() const
+    {
+        return last;
+    }
+
+    const_iterator first;
+    const_iterator last;
+};
+}  // namespace
+
+SocketImplBoost::SocketImplBoost(SocketImplBoost&& other)
+    : m_socket(boost::move(other.m_socket)), m_buffers(std::move(other.m_buffers))
+{}
 
 SocketImplBoost& SocketImplBoost::operator=(SocketImplBoost&& other)
 {
-    m_socket = boost::move(other.m_socket);
+    m_socket  = boost::move(other.m_socket);
+    m_buffers = std::move(other.m_buffers);
     return *this;
 }
 
@@ -60,15 +91,21 @@ std::string SocketImplBoost::get_address() const
     return m_socket.remote_endpoint().address().to_string();
 }
 
-bool SocketImplBoost::write(const std::string& msg)
+void SocketImplBoost::asyncWrite(const std::vector<Message>&      msgs,
+                                 const std::function<void(bool)>& callback)
 {
     if (!m_socket.is_open())
     {
         throw SocketException("cannot write on closed socket");
     }
-    boost::system::error_code ec;
-    boost::asio::write(m_socket, boost::asio::buffer(msg), ec);
-    return !ec;
+    m_buffers.clear();
+    for (const auto& msg : msgs)
+    {
+        m_buffers.push_back(boost::asio::buffer(msg.get()));
+    }
+    boost::asio::async_write(
+        m_socket, BufferView{m_buffers.data(), m_buffers.data() + m_buffers.size()},
+        [callback](const boost::system::error_code& error, std::size_t) { callback(!error); });
 }
 
 void SocketImplBoost::close()
@@ -0,0 +1,229 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include "util/FlatIndex.h"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#    include <immintrin.h>
+#endif
+
+namespace util
+{
+namespace
+{
+/// Key of a free slot
+constexpr std::uint32_t FREE = 0xFFFFFFFF;
+
+/// Key of an erased slot
+constexpr std::uint32_t ERASED = 0xFFFFFFFE;
+
+static_assert(FLATINDEX_GROUP == 8, "a group must fill 8 lanes");
+
+/**
+ * @brief Compare all keys of a group to a key at once.
+ * @param group The first slot of the group
+ * @param key   The key
+ * @return the bits of the matching slots, lowest for the first
+ */
+inline std::uint32_t match(const std::uint32_t* group, std::uint32_t key)
+{
+#if defined(__AVX2__)
+    const __m256i keys = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(group));
+    const __m256i mask = _mm256_cmpeq_epi32(keys, _mm256_set1_epi32(static_cast<int>(key)));
+    return static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(mask)));
+#elif defined(__SSE2__)
+    const __m128i needle = _mm_set1_epi32(static_cast<int>(key));
+    const __m128i low    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+    const __m128i high   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group + 4));
+    return static_cast<std::uint32_t>(
+        _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(low, needle))) |
+        _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(high, needle))) << 4);
+#else
+    std::uint32_t bits = 0;
+    for (std::size_t i = 0; i < FLATINDEX_GROUP; ++i)
+    {
+        bits |= static_cast<std::uint32_t>(group[i] == key) << i;
+    }
+    return bits;
+#endif
+}
+
+/**
+ * @brief Get the index of the lowest bit set.
+ * @param bits The bits; not 0
+ * @return the index
+ */
+inline std::size_t lowest(std::uint32_t bits)
+{
+#if defined(__GNUC__)
+    return static_cast<std::size_t>(__builtin_ctz(bits));
+#else
+    std::size_t index = 0;
+    while (!(bits & 1))
+    {
+        bits >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+/**
+ * @brief Get the capacity to hold an amount of keys at half load.
+ * @param count The amount of keys
+ * @return the capacity
+ */
+inline std::size_t capacityFor(std::size_t count)
+{
+    std::size_t capacity = FLATINDEX_GROUP;
+    while (capacity < count * 2)
+    {
+        capacity *= 2;
+    }
+    return capacity;
+}
+}  // namespace
+
+constexpr std::uint32_t FlatIndex::NONE;
+
+FlatIndex::FlatIndex()
+{
+    rehash(FLATINDEX_GROUP);
+}
+
+std::uint32_t FlatIndex::find(std::uint32_t key) const
+{
+    const std::size_t slot = slotOf(key);
+    return slot < m_keys.size() ? m_values[slot] : NONE;
+}
+
+void FlatIndex::set(std::uint32_t key, std::uint32_t value)
+{
+    std::size_t slot = slotOf(key);
+    if (slot < m_keys.size())
+    {
+        m_values[slot] = value;
+        return;
+    }
+    // keep at least one free slot per probe sequence, so that a miss terminates early
+    if ((m_used + 1) * 8 > m_keys.size() * 7)
+    {
+        rehash(capacityFor(m_size + 1));
+    }
+    const std::size_t groups = m_keys.size() / FLATINDEX_GROUP;
+    for (std::size_t group = groupOf(key);; group = (group + 1) & (groups - 1))
+    {
+        const std::uint32_t* slots = m_keys.data() + group * FLATINDEX_GROUP;
+        const std::uint32_t  open  = match(slots, FREE) | match(slots, ERASED);
+        if (open != 0)
+        {
+            slot = group * FLATINDEX_GROUP + lowest(open);
+            break;
+        }
+    }
+    if (m_keys[slot] == FREE)
+    {
+        ++m_used;
+    }
+    m_keys[slot]   = key;
+    m_values[slot] = value;
+    ++m_size;
+}
+
+bool FlatIndex::erase(std::uint32_t key)
+{
+    const std::size_t slot = slotOf(key);
+    if (slot >= m_keys.size())
+    {
+        return false;
+    }
+    // no probe sequence passes a group with a free slot, so it needs no mark
+    if (match(m_keys.data() + slot / FLATINDEX_GROUP * FLATINDEX_GROUP, FREE) != 0)
+    {
+        m_keys[slot] = FREE;
+        --m_used;
+    }
+    else
+    {
+        m_keys[slot] = ERASED;
+    }
+    --m_size;
+    return true;
+}
+
+void FlatIndex::reserve(std::size_t count)
+{
+    const std::size_t capacity = capacityFor(count);
+    if (capacity > m_keys.size())
+    {
+        rehash(capacity);
+    }
+}
+
+std::size_t FlatIndex::slotOf(std::uint32_t key) const
+{
+    const std::size_t groups = m_keys.size() / FLATINDEX_GROUP;
+    std::size_t       group  = groupOf(key);
+    for (std::size_t probed = 0; probed < groups; ++probed)
+    {
+        const std::uint32_t* slots = m_keys.data() + group * FLATINDEX_GROUP;
+        const std::uint32_t  found = match(slots, key);
+        if (found != 0)
+        {
+            return group * FLATINDEX_GROUP + lowest(found);
+        }
+        if (match(slots, FREE) != 0)
+        {
+            break;
+        }
+        group = (group + 1) & (groups - 1);
+    }
+    return m_keys.size();
+}
+
+std::size_t FlatIndex::groupOf(std::uint32_t key) const
+{
+    // finalizer of MurmurHash3, addresses are anything but evenly distributed
+    key ^= key >> 16;
+    key *= 0x85EBCA6B;
+    key ^= key >> 13;
+    key *= 0xC2B2AE35;
+    key ^= key >> 16;
+    return key & (m_keys.size() / FLATINDEX_GROUP - 1);
+}
+
+void FlatIndex::rehash(std::size_t capacity)
+{
+    std::vector<std::uint32_t> keys(capacity, FREE);
+    std::vector<std::uint32_t> values(capacity);
+    keys.swap(m_keys);
+    values.swap(m_values);
+    m_size = 0;
+    m_used = 0;
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        if (keys[i] < ERASED)
+        {
+            set(keys[i], values[i]);
+        }
+    }
+}
+}  // namespace util
@@ -0,0 +1,94 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include "util/GeoGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "util/math.hpp"
+
+namespace util
+{
+static_assert(GEOGRID_CELLS <= 32, "a row of cells must fit into 32 bits");
+
+GeoGrid::GeoGrid() : GeoGrid(std::numeric_limits<std::int32_t>::max(), 0) {}
+
+GeoGrid::GeoGrid(std::int32_t radius, std::int32_t margin)
+    : m_range(std::max(1.0, static_cast<double>(radius) + std::max(0, margin))),
+      m_margin(std::max(0, margin)),
+      m_enabled(m_range < math::EARTH_RADIUS * math::PI / 2.0)
+{}
+
+bool GeoGrid::moveTo(double latitude, double longitude)
+{
+    if (!m_enabled ||
+        (m_built && math::distance(m_latitude, m_longitude, latitude, longitude) <= m_margin))
+    {
+        return false;
+    }
+    m_latitude  = latitude;
+    m_longitude = longitude;
+    build();
+    return true;
+}
+
+void GeoGrid::build()
+{
+    const double angle = m_range / math::EARTH_RADIUS;
+    const double north = std::min(90.0, m_latitude + math::degree(angle));
+    m_south            = std::max(-90.0, m_latitude - math::degree(angle));
+    m_height           = north - m_south;
+    // the widest parallel of a cap around the center, unless it contains a pole
+    m_halfWidth = north >= 90.0 || m_south <= -90.0 ?
+                      180.0 :
+                      math::degree(std::asin(std::min(
+                          1.0, std::sin(angle) / std::cos(math::radian(m_latitude)))));
+    m_rowScale              = GEOGRID_CELLS / m_height;
+    m_colScale              = GEOGRID_CELLS / (2.0 * m_halfWidth);
+    const double cellHeight = m_height / GEOGRID_CELLS;
+    const double cellWidth  = 2.0 * m_halfWidth / GEOGRID_CELLS;
+
+    for (std::size_t r = 0; r < GEOGRID_CELLS; ++r)
+    {
+        const double bottom   = m_south + r * cellHeight;
+        const double top      = bottom + cellHeight;
+        const double latitude = bottom + cellHeight / 2.0;
+        // along the meridian, then the parallel, is never shorter than the great circle
+        const double maxCos = bottom <= 0.0 && top >= 0.0 ?
+                                  1.0 :
+                                  std::cos(math::radian(std::min(std::abs(bottom), std::abs(top))));
+        const double reach = math::EARTH_RADIUS * (math::radian(cellHeight / 2.0) +
+                                                   maxCos * math::radian(cellWidth / 2.0));
+        m_cells[r] = 0;
+        for (std::size_t c = 0; c < GEOGRID_CELLS; ++c)
+        {
+            const double longitude = m_longitude - m_halfWidth + (c + 0.5) * cellWidth;
+            if (math::distance(m_latitude, m_longitude, latitude, longitude) <= m_range + reach)
+            {
+                m_cells[r] |= 1u << c;
+            }
+        }
+    }
+    m_built = true;
+}
+}  // namespace util
@@ -0,0 +1,320 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include "util/Metrics.h"
+
+#include <cstdio>
+
+util::Metrics metrics;
+
+namespace util
+{
+namespace
+{
+/**
+ * @brief A counter of every feed.
+ */
+struct FeedCounter
+{
+    /// Metric name
+    const char* name;
+
+    /// Description
+    const char* help;
+
+    /// The counter
+    Counter FeedMetrics::*counter;
+};
+
+/// All counters of feeds
+const FeedCounter FEED_COUNTERS[] = {
+    {"vfrb_feed_read_bytes_total", "Bytes read per feed", &FeedMetrics::bytesRead},
+    {"vfrb_feed_read_lines_total", "Lines read per feed", &FeedMetrics::linesRead},
+    {"vfrb_feed_parsed_lines_total", "Lines unpacked by the parser per feed",
+     &FeedMetrics::linesParsed},
+    {"vfrb_feed_skipped_lines_total", "Lines skipped before parsing per feed",
+     &FeedMetrics::linesSkipped},
+    {"vfrb_feed_rejected_lines_total", "Lines rejected by the parser per feed",
+     &FeedMetrics::linesRejected},
+    {"vfrb_feed_accepted_updates_total", "Updates applied per feed",
+     &FeedMetrics::updatesAccepted},
+    {"vfrb_feed_rejected_updates_total", "Updates rejected per feed",
+     &FeedMetrics::updatesRejected},
+    {"vfrb_feed_culled_updates_total", "Updates out of range per feed",
+     &FeedMetrics::updatesCulled},
+    {"vfrb_feed_reconnects_total", "Reconnects per feed", &FeedMetrics::reconnects}};
+
+/**
+ * @brief A latency histogram of every feed.
+ */
+struct FeedHistogram
+{
+    /// Stage name
+    const char* stage;
+
+    /// The histogram
+    Histogram FeedMetrics::*histogram;
+};
+
+/// All latency histograms of feeds
+const FeedHistogram FEED_HISTOGRAMS[] = {{"parse", &FeedMetrics::parseLatency},
+                                         {"store", &FeedMetrics::storeLatency},
+                                         {"process", &FeedMetrics::processLatency},
+                                         {"send", &FeedMetrics::sendLatency}};
+
+/// Name of the latency histogram
+const std::string LATENCY_NAME = "vfrb_feed_latency_seconds";
+
+/// Linear buckets per power of two, as exponent
+constexpr std::uint32_t SUB_BUCKET_BITS = 2;
+
+/// Linear buckets per power of two
+constexpr std::uint64_t SUB_BUCKETS = 1u << SUB_BUCKET_BITS;
+
+/**
+ * @brief Append the HELP and TYPE lines of a metric.
+ * @param dest The destination string
+ * @param name The metric name
+ * @param help The description
+ * @param type The metric type
+ */
+void header(std::string& dest, const std::string& name, const std::string& help,
+            const char* type)
+{
+    dest.append("# HELP ").append(name).append(" ").append(help).append("\n");
+    dest.append("# TYPE ").append(name).append(" ").append(type).append("\n");
+}
+}  // namespace
+
+void Histogram::observe(std::chrono::steady_clock::duration latency, std::uint64_t count) noexcept
+{
+    const auto    micros = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    std::uint64_t value  = micros > 0 ? static_cast<std::uint64_t>(micros) : 0;
+    m_buckets[bucketOf(value)].fetch_add(count, std::memory_order_relaxed);
+    m_count.fetch_add(count, std::memory_order_relaxed);
+    m_sum.fetch_add(value * count, std::memory_order_relaxed);
+}
+
+std::uint64_t Histogram::get_count() const noexcept
+{
+    return m_count.load(std::memory_order_relaxed);
+}
+
+std::uint64_t Histogram::get_sum() const noexcept
+{
+    return m_sum.load(std::memory_order_relaxed);
+}
+
+std::uint64_t Histogram::get_count(std::size_t bucket) const noexcept
+{
+    return m_buckets[bucket].load(std::memory_order_relaxed);
+}
+
+std::uint64_t Histogram::quantile(double q) const noexcept
+{
+    const std::uint64_t count = get_count();
+    if (count == 0)
+    {
+        return 0;
+    }
+    const auto    rank       = static_cast<std::uint64_t>(q * static_cast<double>(count - 1)) + 1;
+    std::uint64_t cumulative = 0;
+    for (std::size_t bucket = 0; bucket < HISTOGRAM_BUCKETS - 1; ++bucket)
+    {
+        cumulative += get_count(bucket);
+        if (cumulative >= rank)
+        {
+            return boundOf(bucket);
+        }
+    }
+    return boundOf(HISTOGRAM_BUCKETS - 1);
+}
+
+std::size_t Histogram::bucketOf(std::uint64_t micros) noexcept
+{
+    if (micros < SUB_BUCKETS)
+    {
+        return static_cast<std::size_t>(micros);
+    }
+    const std::uint32_t exponent = 63 - static_cast<std::uint32_t>(__builtin_clzll(micros));
+    const std::uint32_t shift    = exponent - SUB_BUCKET_BITS;
+    const std::size_t   bucket   = static_cast<std::size_t>(
+        (shift + 1) * SUB_BUCKETS + ((micros >> shift) & (SUB_BUCKETS - 1)));
+    return bucket < HISTOGRAM_BUCKETS ? bucket : HISTOGRAM_BUCKETS - 1;
+}
+
+std::uint64_t Histogram::boundOf(std::size_t bucket) noexcept
+{
+    if (bucket < SUB_BUCKETS)
+    {
+        return bucket + 1;
+    }
+    const std::uint64_t shift = bucket / SUB_BUCKETS - 1;
+    return (SUB_BUCKETS + bucket % SUB_BUCKETS + 1) << shift;
+}
+
+void FeedMetrics::countUpdate(bool accepted,
+                              std::chrono::steady_clock::time_point received) noexcept
+{
+    if (!accepted)
+    {
+        updatesRejected.add();
+        return;
+    }
+    updatesAccepted.add();
+    if (received.time_since_epoch().count() != 0)
+    {
+        storeLatency.observe(std::chrono::steady_clock::now() - received);
+    }
+}
+
+FeedMetrics& Metrics::feed(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& it : m_feeds)
+    {
+        if (it.first == name)
+        {
+            return *it.second;
+        }
+    }
+    m_feeds.emplace_back(name, std::unique_ptr<FeedMetrics>(new FeedMetrics()));
+    return *m_feeds.back().second;
+}
+
+Gauge& Metrics::gauge(const std::string& name, const std::string& help)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& it : m_gauges)
+    {
+        if (it.name == name)
+        {
+            return *it.gauge;
+        }
+    }
+    m_gauges.push_back({name, help, std::unique_ptr<Gauge>(new Gauge())});
+    return *m_gauges.back().gauge;
+}
+
+void Metrics::render(std::string& dest) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    char                        value[48];
+    if (!m_feeds.empty())
+    {
+        for (const auto& counter : FEED_COUNTERS)
+        {
+            header(dest, counter.name, counter.help, "counter");
+            for (const auto& it : m_feeds)
+            {
+                const Counter& count = (*it.second).*counter.counter;
+                std::snprintf(value, sizeof(value), "%llu",
+                              static_cast<unsigned long long>(count.get()));
+                dest.append(counter.name)
+                    .append("{feed=\"")
+                    .append(it.first)
+                    .append("\"} ")
+                    .append(value)
+                    .append("\n");
+            }
+        }
+    }
+    if (!m_feeds.empty())
+    {
+        header(dest, LATENCY_NAME, "Latency from receiving a line to the end of a stage per feed",
+               "histogram");
+        for (const auto& it : m_feeds)
+        {
+            for (const auto& latency : FEED_HISTOGRAMS)
+            {
+                const Histogram&  histogram = (*it.second).*latency.histogram;
+                const std::string labels =
+                    std::string("{feed=\"") + it.first + "\",stage=\"" + latency.stage + "\"";
+                std::uint64_t cumulative = 0;
+                // empty buckets are left out, as they are implied by their successor
+                for (std::size_t bucket = 0; bucket < HISTOGRAM_BUCKETS - 1; ++bucket)
+                {
+                    if (histogram.get_count(bucket) > 0)
+                    {
+                        cumulative += histogram.get_count(bucket);
+                        std::snprintf(value, sizeof(value), "%.6f\"} %llu",
+                                      Histogram::boundOf(bucket) / 1e6,
+                                      static_cast<unsigned long long>(cumulative));
+                        dest.append(LATENCY_NAME)
+                            .append("_bucket")
+                            .append(labels)
+                            .append(",le=\"")
+                            .append(value)
+                            .append("\n");
+                    }
+                }
+                std::snprintf(value, sizeof(value), "%llu",
+                              static_cast<unsigned long long>(histogram.get_count()));
+                dest.append(LATENCY_NAME)
+                    .append("_bucket")
+                    .append(labels)
+                    .append(",le=\"+Inf\"} ")
+                    .append(value)
+                    .append("\n");
+                dest.append(LATENCY_NAME).append("_count").append(labels).append("} ");
+                dest.append(value).append("\n");
+                std::snprintf(value, sizeof(value), "%.6f", histogram.get_sum() / 1e6);
+                dest.append(LATENCY_NAME).append("_sum").append(labels).append("} ");
+                dest.append(value).append("\n");
+            }
+        }
+    }
+    for (const auto& it : m_gauges)
+    {
+        header(dest, it.name, it.help, "gauge");
+        std::snprintf(value, sizeof(value), "%.9g", it.gauge->get());
+        dest.append(it.name).append(" ").append(value).append("\n");
+    }
+}
+
+std::vector<std::string> Metrics::summarizeLatencies() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<std::string>    lines;
+    char                        line[160];
+    for (const auto& it : m_feeds)
+    {
+        for (const auto& latency : FEED_HISTOGRAMS)
+        {
+            const Histogram& histogram = (*it.second).*latency.histogram;
+            if (histogram.get_count() == 0)
+            {
+                continue;
+            }
+            std::snprintf(line, sizeof(line),
+                          "%s %s: n=%llu mean=%.3fms p50<%.3fms p90<%.3fms p99<%.3fms "
+                          "max<%.3fms",
+                          it.first.c_str(), latency.stage,
+                          static_cast<unsigned long long>(histogram.get_count()),
+                          histogram.get_sum() / 1e3 / histogram.get_count(),
+                          histogram.quantile(0.5) / 1e3, histogram.quantile(0.9) / 1e3,
+                          histogram.quantile(0.99) / 1e3, histogram.quantile(1.0) / 1e3);
+            lines.emplace_back(line);
+        }
+    }
+    return lines;
+}
+}  // namespace util
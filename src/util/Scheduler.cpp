@@ -0,0 +1,107 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include "util/Scheduler.h"
+
+#include <algorithm>
+
+/// @def SCHEDULER_SLACK
+/// Streams due within this time are due together; µs
+#define SCHEDULER_SLACK 1000
+
+namespace util
+{
+namespace
+{
+constexpr std::chrono::microseconds SLACK(SCHEDULER_SLACK);
+}  // namespace
+
+Scheduler::Scheduler() : m_notified(false)
+{
+    takeTime();
+}
+
+std::size_t Scheduler::add(Clock::duration period)
+{
+    takeTime();
+    const bool periodic = period.count() > 0;
+    m_streams.push_back(
+        {periodic ? period : Clock::duration::zero(),
+         periodic ? nextBoundary(period) : Clock::time_point::max()});
+    return m_streams.size() - 1;
+}
+
+bool Scheduler::wait()
+{
+    Clock::time_point deadline = Clock::time_point::max();
+    for (const auto& it : m_streams)
+    {
+        deadline = std::min(deadline, it.deadline);
+    }
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (deadline == Clock::time_point::max())
+        {
+            m_condition.wait(lock, [this] { return m_notified.load(); });
+        }
+        else
+        {
+            m_condition.wait_until(lock, deadline, [this] { return m_notified.load(); });
+        }
+    }
+    takeTime();
+    return m_notified.exchange(false);
+}
+
+bool Scheduler::due(std::size_t stream)
+{
+    Stream& it = m_streams.at(stream);
+    if (it.deadline > m_now + SLACK)
+    {
+        return false;
+    }
+    it.deadline = nextBoundary(it.period);
+    return true;
+}
+
+void Scheduler::notify() noexcept
+{
+    if (!m_notified.exchange(true))
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_condition.notify_one();
+    }
+}
+
+Scheduler::Clock::time_point Scheduler::nextBoundary(Clock::duration period) const
+{
+    // past the slack, so a stream due early is not due twice for the same boundary
+    const Clock::duration wall = m_wallNow + SLACK;
+    return m_now + SLACK + (period - wall % period);
+}
+
+void Scheduler::takeTime()
+{
+    m_now     = Clock::now();
+    m_wallNow = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::system_clock::now().time_since_epoch());
+}
+}  // namespace util
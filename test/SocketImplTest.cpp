@@ -21,20 +21,32 @@
 
 #include "SocketImplTest.h"
 
+#include <utility>
+
 namespace server
 {
 namespace net
 {
-SocketImplTest::SocketImplTest(SocketImplTest&& other) : m_socket(other.m_socket) {}
+SocketImplTest::SocketImplTest(SocketImplTest&& other)
+    : m_socket(other.m_socket),
+      m_address(std::move(other.m_address)),
+      m_endpoint(std::move(other.m_endpoint))
+{}
 
 SocketImplTest& SocketImplTest::operator=(SocketImplTest&& other)
 {
-    m_socket = other.m_socket;
+    m_socket   = other.m_socket;
+    m_address  = std::move(other.m_address);
+    m_endpoint = std::move(other.m_endpoint);
     return *this;
 }
 
 SocketImplTest::SocketImplTest(int&& socket) : m_socket(socket) {}
 
+SocketImplTest::SocketImplTest(int&& socket, std::shared_ptr<Endpoint> endpoint)
+    : m_socket(socket), m_endpoint(endpoint)
+{}
+
 SocketImplTest::~SocketImplTest() noexcept {}
 
 std::string SocketImplTest::get_address() const
@@ -42,15 +54,38 @@ std::string SocketImplTest::get_address() const
     return m_address;
 }
 
-bool SocketImplTest::write(const std::string& msg)
+void SocketImplTest::asyncWrite(const std::vector<Message>&      msgs,
+                                const std::function<void(bool)>& callback)
 {
-    m_buffer = msg;
-    return true;
+    m_buffer.clear();
+    for (const auto& msg : msgs)
+    {
+        m_buffer += msg.get();
+    }
+    if (m_endpoint)
+    {
+        m_endpoint->received.push_back(m_buffer);
+        m_endpoint->pending = callback;
+    }
 }
 
 void SocketImplTest::close()
 {
     m_socket = 0;
+    if (m_endpoint)
+    {
+        m_endpoint->pending = nullptr;
+    }
+}
+
+void SocketImplTest::Endpoint::complete(bool success)
+{
+    auto callback = std::move(pending);
+    pending       = nullptr;
+    if (callback)
+    {
+        callback(success);
+    }
 }
 
 int& SocketImplTest::get()
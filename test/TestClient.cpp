@@ -19,9 +19,130 @@
  }
  */
 
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include "client/AprscClient.h"
+#include "client/ClientFactory.h"
+#include "client/Replay.h"
+#include "client/net/Endpoint.hpp"
+#include "client/net/impl/ConnectorImplReplay.h"
+#include "config/Configuration.h"
+#include "config/Properties.h"
+#include "data/AircraftData.h"
+#include "data/GpsData.h"
+#include "feed/AprscFeed.h"
+#include "object/GpsPosition.h"
+
 #include "helper.hpp"
 
 using namespace sctf;
+using namespace client;
+using namespace client::net;
+
+namespace
+{
+config::Properties aprsProperties(const std::string& terms = "")
+{
+    boost::property_tree::ptree tree;
+    tree.add(KV_KEY_HOST, "localhost");
+    tree.add(KV_KEY_PORT, "1234");
+    tree.add(KV_KEY_LOGIN, "user");
+    if (!terms.empty())
+    {
+        tree.add(KV_KEY_AUTO_FILTER, "y");
+        tree.add(KV_KEY_FILTER_TERMS, terms);
+    }
+    return config::Properties(std::move(tree));
+}
+}  // namespace
 
 void test_client(test::TestSuitesRunner& runner)
-{}
+{
+    describe<ConnectorImplReplay>("replay", runner)
+        ->test("pass recorded lines",
+               [] {
+                   const std::string file("replay_test.rec");
+                   {
+                       std::ofstream out(file);
+                       out << "1508245321.25 MSG,3,0,0,AAAAAA\n\n$GPGGA,183552*49\r\n"
+                              "1508245322\tFLRAAAAAA>APRS\n";
+                   }
+                   auto replay = std::make_shared<Replay>(
+                       std::unordered_map<std::string, std::string>{{"feed", file}}, 0.0);
+                   ConnectorImplReplay      connector(replay);
+                   std::vector<std::string> received;
+                   ReadCallback             read = [&](ErrorCode error, const Lines& lines) {
+                       assertTrue(error == ErrorCode::SUCCESS);
+                       for (const auto& it : lines)
+                       {
+                           received.emplace_back(it.data(), it.size());
+                       }
+                       connector.onRead(read);
+                   };
+                   connector.onConnect({replay->fileOf("feed"), REPLAY_PORT},
+                                       [&](ErrorCode error) {
+                                           assertTrue(error == ErrorCode::SUCCESS);
+                                           connector.onRead(read);
+                                       });
+                   connector.run();
+                   std::remove(file.c_str());
+                   assertTrue(replay->done());
+                   assertEquals(replay->get_lines(), 3u);
+                   assertEquals(received.size(), 3u);
+                   assertEqStr(received[0], "MSG,3,0,0,AAAAAA\r\n");
+                   assertEqStr(received[1], "$GPGGA,183552*49\r\n");
+                   assertEqStr(received[2], "FLRAAAAAA>APRS\r\n");
+               })
+        ->test("missing recording", [] {
+            auto replay = std::make_shared<Replay>(
+                std::unordered_map<std::string, std::string>{{"feed", "not_existing.rec"}}, 1.0);
+            assertException(replay->fileOf("other"), std::logic_error);
+            {
+                ConnectorImplReplay connector(replay);
+                assertFalse(replay->done());
+                connector.onConnect({replay->fileOf("feed"), REPLAY_PORT},
+                                    [](ErrorCode) { assertTrue(false); });
+                connector.run();
+            }
+            assertTrue(replay->done());
+            assertEquals(replay->get_lines(), 0u);
+        });
+
+    describe<AprscClient>("filter", runner)
+        ->test("combine filters of shared feeds",
+               [] {
+                   auto data = std::make_shared<data::AircraftData>(0);
+                   auto gps  = std::make_shared<data::GpsData>(
+                       object::GpsPosition({49.0, 8.0, 0}, 48.0), false);
+                   auto near = std::make_shared<feed::AprscFeed>("near", aprsProperties("t/o"),
+                                                                 data, 100000, gps, 40000);
+                   auto far  = std::make_shared<feed::AprscFeed>("far", aprsProperties("t/m"),
+                                                                data, 100000, gps, 90000);
+                   auto none = std::make_shared<feed::AprscFeed>("none", aprsProperties(), data,
+                                                                 100000, gps, 40000);
+                   auto client = ClientFactory::createClientFor(near);
+                   assertTrue(client->equals(*ClientFactory::createClientFor(far)));
+                   client->subscribe(near);
+                   client->subscribe(none);
+                   client->subscribe(far);
+                   assertEqStr(std::static_pointer_cast<AprscClient>(client)->get_filter(),
+                               "filter r/49.0000/8.0000/50 t/o r/49.0000/8.0000/100 t/m");
+               })
+        ->test("without filter", [] {
+            auto data = std::make_shared<data::AircraftData>(0);
+            auto gps  = std::make_shared<data::GpsData>();
+            auto none = std::make_shared<feed::AprscFeed>("none", aprsProperties(), data, 100000,
+                                                          gps, 40000);
+            auto client = ClientFactory::createClientFor(none);
+            client->subscribe(none);
+            assertEqStr(std::static_pointer_cast<AprscClient>(client)->get_filter(), "");
+        });
+}
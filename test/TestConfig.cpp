@@ -53,11 +53,15 @@ void test_config(test::TestSuitesRunner& runner)
                    std::stringstream conf_in;
                    conf_in << "[" SECT_KEY_GENERAL "]\n" << KV_KEY_FEEDS "=" SECT_KEY_ATMOS "1\n";
                    conf_in << KV_KEY_SERVER_PORT "=1234\n" << KV_KEY_GND_MODE "=y\n";
+                   conf_in << KV_KEY_LOCAL_RADIUS "=20000\n";
                    conf_in << "[" SECT_KEY_FALLBACK "]\n" << KV_KEY_LATITUDE "=77.777777\n";
                    conf_in << KV_KEY_LONGITUDE "=-12.121212\n" << KV_KEY_ALTITUDE "=1234\n";
                    conf_in << KV_KEY_GEOID "=40.4\n" << KV_KEY_PRESSURE "=999.9\n";
                    conf_in << "[" SECT_KEY_FILTER "]\n" << KV_KEY_MAX_HEIGHT "=-1\n";
                    conf_in << KV_KEY_MAX_DIST "=10000\n";
+                   conf_in << "[" SECT_KEY_OUTPUT "]\n" << KV_KEY_AIRCRAFT_RATE "=4\n";
+                   conf_in << KV_KEY_ATMOS_RATE "=0\n" << KV_KEY_WIND_RATE "=-1\n";
+                   conf_in << KV_KEY_GPS_RATE "=100\n" << KV_KEY_EMIT_ON_UPDATE "=y\n";
                    conf_in << "[" SECT_KEY_ATMOS "1]\n" << KV_KEY_HOST "=localhost\n";
                    conf_in << KV_KEY_PORT "=3456\n" << KV_KEY_PRIORITY "=1\n";
                    Configuration config(conf_in);
@@ -73,6 +77,12 @@ void test_config(test::TestSuitesRunner& runner)
                    assertEquals(config.get_atmPressure(), 999.9);
                    assertEquals(config.get_maxHeight(), INT32_MAX);
                    assertEquals(config.get_maxDistance(), 10000);
+                   assertEquals(config.get_localRadius(), 20000);
+                   assertEquals(config.get_aircraftRate(), 4.0);
+                   assertEquals(config.get_atmosphereRate(), 0.0);
+                   assertEquals(config.get_windRate(), 1.0);
+                   assertEquals(config.get_gpsRate(), 50.0);
+                   assertTrue(config.get_emitOnUpdate());
                })
         ->test("only valid feeds", [] {
             std::stringstream conf_in;
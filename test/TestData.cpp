@@ -19,7 +19,11 @@
  }
  */
 
+#include <cstdint>
+#include <limits>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <boost/regex.hpp>
 
@@ -30,6 +34,7 @@
 #include "feed/parser/AprsParser.h"
 #include "feed/parser/SbsParser.h"
 #include "object/impl/DateTimeImplBoost.h"
+#include "util/MpscQueue.hpp"
 
 #include "helper.hpp"
 
@@ -77,6 +82,65 @@ void test_data(test::TestSuitesRunner& runner)
                     data.processAircrafts(pos, press);
                 }
             })
+        ->test(
+            "delete aircraft, keep others",
+            [] {
+                feed::parser::SbsParser sbsParser;
+                AircraftData            data(0, 1);
+                Aircraft                ac;
+                Position                pos{49.0, 8.0, 0};
+                double                  press = 1013.25;
+                std::string             serial;
+                sbsParser.unpack(
+                    "MSG,3,0,0,AAAAAA,0,2017/02/16,20:11:30.772,2017/02/16,20:11:30.772,,3281,,,49.000000,8.000000,,,,,,0",
+                    ac);
+                data.update(std::move(ac));
+                for (int i = 0; i < AC_DELETE_THRESHOLD - 1; ++i)
+                {
+                    data.processAircrafts(pos, press);
+                }
+                sbsParser.unpack(
+                    "MSG,3,0,0,BBBBBB,0,2017/02/16,20:11:30.772,2017/02/16,20:11:30.772,,3281,,,49.000000,8.000000,,,,,,0",
+                    ac);
+                data.update(std::move(ac));
+                sbsParser.unpack(
+                    "MSG,3,0,0,CCCCCC,0,2017/02/16,20:11:30.772,2017/02/16,20:11:30.772,,3281,,,49.000000,8.000000,,,,,,0",
+                    ac);
+                data.update(std::move(ac));
+                data.processAircrafts(pos, press);
+                sbsParser.unpack(
+                    "MSG,3,0,0,CCCCCC,0,2017/02/16,20:11:31.772,2017/02/16,20:11:31.772,,6562,,,49.000000,8.000000,,,,,,0",
+                    ac);
+                assertTrue(data.update(std::move(ac)));
+                data.processAircrafts(pos, press);
+                data.get_serialized(serial);
+                assertEquals(serial.find("AAAAAA"), std::string::npos);
+                assertTrue(serial.find("$PFLAU,,,,1,0,0,0,2000,0,CCCCCC*") != std::string::npos);
+                assertTrue(serial.find("BBBBBB") != std::string::npos);
+            })
+        ->test(
+            "skip bad aircraft, keep others",
+            [] {
+                feed::parser::SbsParser sbsParser;
+                AircraftData            data(std::numeric_limits<std::int32_t>::max());
+                Aircraft                ac;
+                Position                pos{49.0, 8.0, 0};
+                double                  press = 1013.25;
+                std::string             serial;
+
+                sbsParser.unpack(
+                    "MSG,3,0,0,AAAAAA,0,2017/02/16,20:11:30.772,2017/02/16,20:11:30.772,,3281,,,95.000000,8.000000,,,,,,0",
+                    ac);
+                data.update(std::move(ac));
+                sbsParser.unpack(
+                    "MSG,3,0,0,CCCCCC,0,2017/02/16,20:11:30.772,2017/02/16,20:11:30.772,,6562,,,49.000000,8.000000,,,,,,0",
+                    ac);
+                data.update(std::move(ac));
+                data.processAircrafts(pos, press);
+                data.get_serialized(serial);
+                assertEquals(serial.find("AAAAAA"), std::string::npos);
+                assertTrue(serial.find("$PFLAU,,,,1,0,0,0,2000,0,CCCCCC*") != std::string::npos);
+            })
         ->test(
             "prefer FLARM, accept again if no input",
             [] {
@@ -153,6 +217,201 @@ void test_data(test::TestSuitesRunner& runner)
             assertEqStr(match.str(2), "305");
         });
 
+    describe<AircraftData>("cull out of range", runner)
+        ->test("reject updates beyond max distance", [] {
+            feed::parser::SbsParser sbsParser;
+            AircraftData            data(40000);
+            Aircraft                ac;
+            std::string             serial;
+            sbsParser.unpack(
+                "MSG,3,0,0,AAAAAA,0,2017/02/16,20:11:30.772,2017/02/16,20:11:30.772,,3281,,,52.000000,8.000000,,,,,,0",
+                ac);
+            assertTrue(data.update(std::move(ac)));
+            data.processAircrafts({49.0, 8.0, 0}, 1013.25);
+            sbsParser.unpack(
+                "MSG,3,0,0,BBBBBB,0,2017/02/16,20:11:30.772,2017/02/16,20:11:30.772,,3281,,,52.000000,8.000000,,,,,,0",
+                ac);
+            assertFalse(data.update(std::move(ac)));
+            sbsParser.unpack(
+                "MSG,3,0,0,CCCCCC,0,2017/02/16,20:11:30.772,2017/02/16,20:11:30.772,,3281,,,49.300000,8.000000,,,,,,0",
+                ac);
+            assertTrue(data.update(std::move(ac)));
+            data.processAircrafts({52.0, 8.0, 0}, 1013.25);
+            sbsParser.unpack(
+                "MSG,3,0,0,BBBBBB,0,2017/02/16,20:11:31.772,2017/02/16,20:11:31.772,,3281,,,52.000000,8.000000,,,,,,0",
+                ac);
+            assertTrue(data.update(std::move(ac)));
+            data.processAircrafts({52.0, 8.0, 0}, 1013.25);
+            data.get_serialized(serial);
+            assertTrue(serial.find("BBBBBB") != std::string::npos);
+        });
+
+    describe<AircraftData>("serve on update", runner)
+        ->test("process updated without aging",
+               [] {
+                   feed::parser::SbsParser sbsParser;
+                   AircraftData            data;
+                   Aircraft                ac;
+                   Position                pos{49.0, 8.0, 0};
+                   double                  press = 1013.25;
+                   std::string             updated;
+                   std::string             serial;
+                   sbsParser.unpack(
+                       "MSG,3,0,0,BBBBBB,0,2017/02/16,20:11:30.772,2017/02/16,20:11:30.772,,3281,,,49.000000,8.000000,,,,,,0",
+                       ac);
+                   data.update(std::move(ac));
+                   data.processAircrafts(pos, press, false, &updated);
+                   assertTrue(updated.find("BBBBBB") != std::string::npos);
+                   assertTrue(data.isUpdated());
+                   for (int i = 0; i < OBJ_OUTDATED; ++i)
+                   {
+                       updated.clear();
+                       data.processAircrafts(pos, press, false, &updated);
+                       assertTrue(updated.empty());
+                   }
+                   data.get_serialized(serial);
+                   assertTrue(serial.find("BBBBBB") != std::string::npos);
+                   assertFalse(data.isUpdated());
+               })
+        ->test("notify when handed over", [] {
+            feed::parser::SbsParser sbsParser;
+            AircraftData            aircraftData;
+            WindData                windData;
+            Aircraft                ac;
+            Wind                    wind;
+            int                     notified = 0;
+            aircraftData.set_notify([&notified] { ++notified; });
+            windData.set_notify([&notified] { ++notified; });
+            sbsParser.unpack(
+                "MSG,3,0,0,BBBBBB,0,2017/02/16,20:11:30.772,2017/02/16,20:11:30.772,,3281,,,49.000000,8.000000,,,,,,0",
+                ac);
+            assertTrue(aircraftData.enqueue(std::move(ac)));
+            assertEquals(notified, 1);
+            std::string serial;
+            windData.get_serialized(serial);
+            assertFalse(windData.isUpdated());
+            wind.set_serialized("$WIMWV,242.8,R,6.9,N,A*20\r\n");
+            assertTrue(windData.update(std::move(wind)));
+            assertEquals(notified, 2);
+            assertTrue(windData.isUpdated());
+        });
+
+    describe<::util::MpscQueue<int>>("ingest queue", runner)
+        ->test("push, pop, drop",
+               [] {
+                   ::util::MpscQueue<int> queue(3);
+                   int                  value = 0;
+                   assertEquals(queue.get_capacity(), 4u);
+                   assertFalse(queue.pop(value));
+                   for (int i = 0; i < 5; ++i)
+                   {
+                       queue.push(std::move(i));
+                   }
+                   assertEquals(queue.get_depth(), 4u);
+                   assertEquals(queue.get_drops(), 1u);
+                   for (int i = 0; i < 4; ++i)
+                   {
+                       assertTrue(queue.pop(value));
+                       assertEquals(value, i);
+                   }
+                   assertFalse(queue.pop(value));
+                   assertEquals(queue.get_depth(), 0u);
+               })
+        ->test("push batch",
+               [] {
+                   ::util::MpscQueue<int> queue(8);
+                   std::vector<int>     batch = {1, 2, 3, 4, 5};
+                   int                  value = 0;
+                   assertTrue(queue.push(std::move(value)));
+                   assertEquals(queue.push(batch.data(), batch.size()), 5u);
+                   assertEquals(queue.push(batch.data(), batch.size()), 2u);
+                   assertEquals(queue.get_drops(), 3u);
+                   assertEquals(queue.get_depth(), 8u);
+                   for (int i = 0; i < 6; ++i)
+                   {
+                       assertTrue(queue.pop(value));
+                       assertEquals(value, i);
+                   }
+                   assertEquals(queue.push(batch.data(), 4), 4u);
+                   assertEquals(queue.get_depth(), 6u);
+               })
+        ->test("multiple producers",
+               [] {
+                   ::util::MpscQueue<int>     queue(1 << 16);
+                   std::vector<std::thread> producers;
+                   std::int64_t             sum   = 0;
+                   int                      value = 0;
+                   for (int p = 0; p < 4; ++p)
+                   {
+                       producers.emplace_back([&queue] {
+                           for (int i = 1; i <= 10000; ++i)
+                           {
+                               queue.push(std::move(i));
+                           }
+                       });
+                   }
+                   for (auto& it : producers)
+                   {
+                       it.join();
+                   }
+                   while (queue.pop(value))
+                   {
+                       sum += value;
+                   }
+                   assertEquals(sum, 4 * 50005000ll);
+                   assertEquals(queue.get_drops(), 0u);
+               })
+        ->test("apply aircrafts on flush",
+               [] {
+                   feed::parser::SbsParser sbsParser;
+                   AircraftData            data;
+                   Aircraft                ac;
+                   std::string             serial;
+                   sbsParser.unpack(
+                       "MSG,3,0,0,BBBBBB,0,2017/02/16,20:11:30.772,2017/02/16,20:11:30.772,,3281,,,49.000000,8.000000,,,,,,0",
+                       ac);
+                   assertTrue(data.enqueue(std::move(ac)));
+                   assertEquals(data.get_queueDepth(), 1u);
+                   data.processAircrafts({49.0, 8.0, 0}, 1013.25);
+                   data.get_serialized(serial);
+                   assertTrue(serial.empty());
+                   assertEquals(data.flush(), 1u);
+                   assertEquals(data.get_queueDepth(), 0u);
+                   data.processAircrafts({49.0, 8.0, 0}, 1013.25);
+                   data.get_serialized(serial);
+                   assertFalse(serial.empty());
+               })
+        ->test("count only accepted updates on flush",
+               [] {
+                   feed::parser::SbsParser sbsParser;
+                   AircraftData            data;
+                   Aircraft                ac;
+                   sbsParser.unpack(
+                       "MSG,3,0,0,BBBBBB,0,2017/02/16,20:11:31.772,2017/02/16,20:11:31.772,,3281,,,49.000000,8.000000,,,,,,0",
+                       ac);
+                   assertTrue(data.enqueue(std::move(ac)));
+                   // older, hence rejected
+                   sbsParser.unpack(
+                       "MSG,3,0,0,BBBBBB,0,2017/02/16,20:11:30.772,2017/02/16,20:11:30.772,,3281,,,49.000000,8.000000,,,,,,0",
+                       ac);
+                   assertTrue(data.enqueue(std::move(ac)));
+                   assertEquals(data.flush(), 1u);
+                   assertEquals(data.get_queueDepth(), 0u);
+               })
+        ->test("lock good position in ground mode", [] {
+            GpsData     data(GpsPosition({0.0, 0.0, 0}, 48.0), true);
+            GpsPosition pos({10.0, 85.0, 100}, 40.0);
+            pos.set_nrOfSatellites(9);
+            pos.set_fixQuality(1);
+            pos.set_dilution(0.9);
+            pos.set_timeStamp(TimeStamp<timestamp::DateTimeImplBoost>(helper::timePlus(-1),
+                                                                      timestamp::Format::HHMMSS));
+            assertTrue(data.enqueue(std::move(pos)));
+            assertEquals(data.flush(), 1u);
+            assertEquals(data.get_position().latitude, 10.0);
+            assertException(data.enqueue(std::move(pos)), PositionAlreadyLocked);
+        });
+
     describeParallel<GpsData>("gps string", runner)
         ->test("correct gps position",
                [] {
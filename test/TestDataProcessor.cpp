@@ -19,16 +19,85 @@
  }
  */
 
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
 #include "data/processor/AircraftProcessor.h"
 #include "data/processor/GpsProcessor.h"
+#include "data/processor/NmeaWriter.h"
+#include "util/math.hpp"
 #include "helper.hpp"
 
 using namespace data::processor;
 using namespace object;
 using namespace sctf;
 
+namespace
+{
+void assertBatchEqualsSingle(AircraftProcessor& single, AircraftProcessor& batch,
+                             const Position& ref, std::vector<Aircraft>& aircrafts)
+{
+    std::vector<AircraftRecord>        records(aircrafts.cbegin(), aircrafts.cend());
+    std::vector<std::string>           reports(aircrafts.size());
+    std::vector<const AircraftRecord*> due;
+    std::vector<std::string*>          dueReports;
+    for (std::size_t i = 0; i < records.size(); ++i)
+    {
+        due.push_back(&records[i]);
+        dueReports.push_back(&reports[i]);
+    }
+    single.referTo(ref, 1013.25);
+    batch.referTo(ref, 1013.25);
+    batch.process(due, dueReports);
+    for (std::size_t i = 0; i < aircrafts.size(); ++i)
+    {
+        single.process(aircrafts[i]);
+        assertEqStr(reports[i], aircrafts[i].get_serialized());
+    }
+}
+}  // namespace
+
 void test_data_processor(test::TestSuitesRunner& runner)
 {
+    describe<NmeaWriter>("Write NMEA sentences", runner)
+        ->test("checksum",
+               [] {
+                   std::string dest;
+                   NmeaWriter  writer(dest);
+                   writer.begin("abc").finish();
+                   writer.begin("PFLAU,").appendInt(-1).finish();
+                   assertEqStr(dest, "$abc*60\r\n$PFLAU,-1*7e\r\n");
+               })
+        ->test("format like printf", [] {
+            const double values[] = {0.0,  -0.0,    0.125,   2.5,      3.5,    -0.04, 1.005,
+                                     0.05, 59.9999, 59.99995, 9.99995, 123.45, 1e10,  -7.25};
+            char         buffer[64];
+            for (double v : values)
+            {
+                for (std::uint32_t d = 0; d < 5; ++d)
+                {
+                    std::string dest;
+                    NmeaWriter(dest).appendFixed(v, d, 7);
+                    std::snprintf(buffer, sizeof(buffer), "%07.*lf", static_cast<int>(d), v);
+                    assertEqStr(dest, buffer);
+                }
+            }
+            for (std::int32_t i = -20000; i < 20000; i += 7)
+            {
+                double      v = i / 1024.0 + i / 3.0;
+                std::string dest;
+                std::uint32_t address = static_cast<std::uint32_t>(i) & 0xFFFFFF;
+                NmeaWriter(dest).appendFixed(v, 4).appendInt(i, 3).appendHex(i & 0xFF).appendHex(
+                    address, 6);
+                std::snprintf(buffer, sizeof(buffer), "%.4lf%03d%X%06X", v, i, i & 0xFF, address);
+                assertEqStr(dest, buffer);
+            }
+        });
+
     describe<GpsProcessor>("Process GPS data", runner)->test("process", [] {
         GpsProcessor gpsp;
         boost::smatch match;
@@ -43,7 +112,7 @@ void test_data_processor(test::TestSuitesRunner& runner)
                [] {
                    AircraftProcessor proc;
                    Aircraft ac;
-                   ac.set_id("BBBBBB");
+                   ac.set_id(0xBBBBBB);
                    ac.set_fullInfo(false);
                    ac.set_targetType(Aircraft::TargetType::TRANSPONDER);
                    ac.set_position({49.0, 8.0, math::doubleToInt(math::FEET_2_M * 3281)});
@@ -67,7 +136,7 @@ void test_data_processor(test::TestSuitesRunner& runner)
         ->test("filter distance", [] {
             AircraftProcessor proc(0);
             Aircraft ac;
-            ac.set_id("BBBBBB");
+            ac.set_id(0xBBBBBB);
             ac.set_fullInfo(false);
             ac.set_targetType(Aircraft::TargetType::TRANSPONDER);
             ac.set_position({49.0, 8.0, math::doubleToInt(math::FEET_2_M * 3281)});
@@ -81,7 +150,7 @@ void test_data_processor(test::TestSuitesRunner& runner)
                [] {
                    AircraftProcessor proc;
                    Aircraft ac;
-                   ac.set_id("BBBBBB");
+                   ac.set_id(0xBBBBBB);
                    ac.set_fullInfo(false);
                    ac.set_targetType(Aircraft::TargetType::TRANSPONDER);
                    ac.set_position({0.1, 0.0, math::doubleToInt(math::FEET_2_M * 3281)});
@@ -102,7 +171,7 @@ void test_data_processor(test::TestSuitesRunner& runner)
                [] {
                    AircraftProcessor proc;
                    Aircraft ac;
-                   ac.set_id("BBBBBB");
+                   ac.set_id(0xBBBBBB);
                    ac.set_fullInfo(false);
                    ac.set_targetType(Aircraft::TargetType::TRANSPONDER);
                    ac.set_position({-0.1, 0.0, math::doubleToInt(math::FEET_2_M * 3281)});
@@ -123,7 +192,7 @@ void test_data_processor(test::TestSuitesRunner& runner)
                [] {
                    AircraftProcessor proc;
                    Aircraft ac;
-                   ac.set_id("BBBBBB");
+                   ac.set_id(0xBBBBBB);
                    ac.set_fullInfo(false);
                    ac.set_targetType(Aircraft::TargetType::TRANSPONDER);
                    ac.set_position({89.9, 0.0, math::doubleToInt(math::FEET_2_M * 3281)});
@@ -144,7 +213,7 @@ void test_data_processor(test::TestSuitesRunner& runner)
                [] {
                    AircraftProcessor proc;
                    Aircraft ac;
-                   ac.set_id("BBBBBB");
+                   ac.set_id(0xBBBBBB);
                    ac.set_fullInfo(false);
                    ac.set_targetType(Aircraft::TargetType::TRANSPONDER);
                    ac.set_position({-89.9, 0.0, math::doubleToInt(math::FEET_2_M * 3281)});
@@ -165,7 +234,7 @@ void test_data_processor(test::TestSuitesRunner& runner)
                [] {
                    AircraftProcessor proc;
                    Aircraft ac;
-                   ac.set_id("BBBBBB");
+                   ac.set_id(0xBBBBBB);
                    ac.set_fullInfo(false);
                    ac.set_targetType(Aircraft::TargetType::TRANSPONDER);
                    ac.set_position({0.0, -0.1, math::doubleToInt(math::FEET_2_M * 3281)});
@@ -186,7 +255,7 @@ void test_data_processor(test::TestSuitesRunner& runner)
                [] {
                    AircraftProcessor proc;
                    Aircraft ac;
-                   ac.set_id("BBBBBB");
+                   ac.set_id(0xBBBBBB);
                    ac.set_fullInfo(false);
                    ac.set_targetType(Aircraft::TargetType::TRANSPONDER);
                    ac.set_position({0.0, 0.1, math::doubleToInt(math::FEET_2_M * 3281)});
@@ -207,7 +276,7 @@ void test_data_processor(test::TestSuitesRunner& runner)
                [] {
                    AircraftProcessor proc;
                    Aircraft ac;
-                   ac.set_id("BBBBBB");
+                   ac.set_id(0xBBBBBB);
                    ac.set_fullInfo(false);
                    ac.set_targetType(Aircraft::TargetType::TRANSPONDER);
                    ac.set_position({60.0, -0.1, math::doubleToInt(math::FEET_2_M * 3281)});
@@ -228,7 +297,7 @@ void test_data_processor(test::TestSuitesRunner& runner)
                [] {
                    AircraftProcessor proc;
                    Aircraft ac;
-                   ac.set_id("BBBBBB");
+                   ac.set_id(0xBBBBBB);
                    ac.set_fullInfo(false);
                    ac.set_targetType(Aircraft::TargetType::TRANSPONDER);
                    ac.set_position({-60.0, 0.1, math::doubleToInt(math::FEET_2_M * 3281)});
@@ -249,7 +318,7 @@ void test_data_processor(test::TestSuitesRunner& runner)
                [] {
                    AircraftProcessor proc;
                    Aircraft ac;
-                   ac.set_id("BBBBBB");
+                   ac.set_id(0xBBBBBB);
                    ac.set_fullInfo(false);
                    ac.set_targetType(Aircraft::TargetType::TRANSPONDER);
                    ac.set_position({0.0, -179.9, math::doubleToInt(math::FEET_2_M * 3281)});
@@ -270,7 +339,7 @@ void test_data_processor(test::TestSuitesRunner& runner)
                [] {
                    AircraftProcessor proc;
                    Aircraft ac;
-                   ac.set_id("BBBBBB");
+                   ac.set_id(0xBBBBBB);
                    ac.set_fullInfo(false);
                    ac.set_targetType(Aircraft::TargetType::TRANSPONDER);
                    ac.set_position({0.0, 179.9, math::doubleToInt(math::FEET_2_M * 3281)});
@@ -292,7 +361,7 @@ void test_data_processor(test::TestSuitesRunner& runner)
             [] {
                 AircraftProcessor proc;
                 Aircraft ac;
-                ac.set_id("BBBBBB");
+                ac.set_id(0xBBBBBB);
                 ac.set_fullInfo(false);
                 ac.set_targetType(Aircraft::TargetType::TRANSPONDER);
                 ac.set_position({33.825808, -112.219232, math::doubleToInt(math::FEET_2_M * 3281)});
@@ -314,7 +383,7 @@ void test_data_processor(test::TestSuitesRunner& runner)
             [] {
                 AircraftProcessor proc;
                 Aircraft ac;
-                ac.set_id("BBBBBB");
+                ac.set_id(0xBBBBBB);
                 ac.set_fullInfo(false);
                 ac.set_targetType(Aircraft::TargetType::TRANSPONDER);
                 ac.set_position({-34.699833, -58.791788, math::doubleToInt(math::FEET_2_M * 3281)});
@@ -335,7 +404,7 @@ void test_data_processor(test::TestSuitesRunner& runner)
                [] {
                    AircraftProcessor proc;
                    Aircraft ac;
-                   ac.set_id("BBBBBB");
+                   ac.set_id(0xBBBBBB);
                    ac.set_fullInfo(false);
                    ac.set_targetType(Aircraft::TargetType::TRANSPONDER);
                    ac.set_position({5.386705, -5.750365, math::doubleToInt(math::FEET_2_M * 3281)});
@@ -357,7 +426,7 @@ void test_data_processor(test::TestSuitesRunner& runner)
             [] {
                 AircraftProcessor proc;
                 Aircraft ac;
-                ac.set_id("BBBBBB");
+                ac.set_id(0xBBBBBB);
                 ac.set_fullInfo(false);
                 ac.set_targetType(Aircraft::TargetType::TRANSPONDER);
                 ac.set_position({-23.229517, 15.049683, math::doubleToInt(math::FEET_2_M * 3281)});
@@ -379,7 +448,7 @@ void test_data_processor(test::TestSuitesRunner& runner)
             [] {
                 AircraftProcessor proc;
                 Aircraft ac;
-                ac.set_id("BBBBBB");
+                ac.set_id(0xBBBBBB);
                 ac.set_fullInfo(false);
                 ac.set_targetType(Aircraft::TargetType::TRANSPONDER);
                 ac.set_position({-26.152199, 133.376684, math::doubleToInt(math::FEET_2_M * 3281)});
@@ -400,7 +469,7 @@ void test_data_processor(test::TestSuitesRunner& runner)
                [] {
                    AircraftProcessor proc;
                    Aircraft ac;
-                   ac.set_id("BBBBBB");
+                   ac.set_id(0xBBBBBB);
                    ac.set_fullInfo(false);
                    ac.set_targetType(Aircraft::TargetType::TRANSPONDER);
                    ac.set_position({49.719445, 9.087646, math::doubleToInt(math::FEET_2_M * 3281)});
@@ -420,7 +489,7 @@ void test_data_processor(test::TestSuitesRunner& runner)
         ->test("Asia", [] {
             AircraftProcessor proc;
             Aircraft ac;
-            ac.set_id("BBBBBB");
+            ac.set_id(0xBBBBBB);
             ac.set_fullInfo(false);
             ac.set_targetType(Aircraft::TargetType::TRANSPONDER);
             ac.set_position({32.896360, 103.855837, math::doubleToInt(math::FEET_2_M * 3281)});
@@ -437,4 +506,117 @@ void test_data_processor(test::TestSuitesRunner& runner)
             assertEqStr(match.str(2), "225589");
             assertEqStr(match.str(3), "1000");
         });
+
+    describe<AircraftProcessor>("process in batch", runner)
+        ->test("same as single",
+               [] {
+                   const Position refs[] = {{49.0, 8.0, 0},     {-0.1, 0.0, 0},  {89.9, 180.0, 0},
+                                            {-89.9, 180.0, 0}, {0.0, 179.9, 0}, {65.900837, 101.570680, 0}};
+                   std::mt19937                           gen(42);
+                   std::uniform_real_distribution<double> near(-3.0, 3.0);
+                   std::uniform_real_distribution<double> lat(-90.0, 90.0);
+                   std::uniform_real_distribution<double> lon(-180.0, 180.0);
+                   AircraftProcessor                      single;
+                   AircraftProcessor                      batch;
+                   for (const auto& ref : refs)
+                   {
+                       std::vector<Aircraft> aircrafts(203);
+                       aircrafts[0].set_position({ref.latitude, ref.longitude, 1000});
+                       aircrafts[1].set_position({-ref.latitude, ref.longitude + 180.0, 1000});
+                       for (std::size_t i = 2; i < aircrafts.size(); ++i)
+                       {
+                           aircrafts[i].set_position(
+                               i % 2 ? Position{lat(gen), lon(gen), 1000} :
+                                       Position{std::max(-90.0, std::min(90.0, ref.latitude + near(gen))),
+                                                ref.longitude + near(gen), 1000});
+                       }
+                       for (auto& it : aircrafts)
+                       {
+                           it.set_id(0xBBBBBB);
+                           it.set_fullInfo(false);
+                       }
+                       assertBatchEqualsSingle(single, batch, ref, aircrafts);
+                   }
+               })
+        ->test("same as single with local radius",
+               [] {
+                   const Position refs[] = {{49.0, 8.0, 0}, {-60.0, -70.0, 0}, {0.0, 179.99, 0}};
+                   std::mt19937                           gen(42);
+                   std::uniform_real_distribution<double> near(-0.2, 0.2);
+                   const std::int32_t max = std::numeric_limits<std::int32_t>::max();
+                   AircraftProcessor                      single(max, 10000);
+                   AircraftProcessor                      batch(max, 10000);
+                   for (const auto& ref : refs)
+                   {
+                       std::vector<Aircraft> aircrafts(101);
+                       for (auto& it : aircrafts)
+                       {
+                           it.set_id(0xBBBBBB);
+                           it.set_fullInfo(false);
+                           it.set_position(
+                               {ref.latitude + near(gen), ref.longitude + near(gen), 1000});
+                       }
+                       aircrafts[0].set_position({ref.latitude, ref.longitude, 1000});
+                       assertBatchEqualsSingle(single, batch, ref, aircrafts);
+                   }
+               })
+        ->test("empty batch", [] {
+            AircraftProcessor proc;
+            proc.process(std::vector<const AircraftRecord*>(), std::vector<std::string*>());
+        });
+
+    describe<AircraftProcessor>("process on local plane", runner)
+        ->test("close to haversine",
+               [] {
+                   const Position refs[] = {{49.0, 8.0, 0}, {-60.0, -70.0, 0}, {60.0, 25.0, 0},
+                                            {0.0, 0.0, 0}};
+                   std::mt19937                           gen(42);
+                   std::uniform_real_distribution<double> near(-0.06, 0.06);
+                   const std::int32_t max = std::numeric_limits<std::int32_t>::max();
+                   AircraftProcessor                      exact;
+                   AircraftProcessor                      local(max, 10000);
+                   for (const auto& ref : refs)
+                   {
+                       exact.referTo(ref, 1013.25);
+                       local.referTo(ref, 1013.25);
+                       for (int i = 0; i < 200; ++i)
+                       {
+                           Aircraft ac;
+                           ac.set_id(0xBBBBBB);
+                           ac.set_fullInfo(false);
+                           ac.set_position(
+                               {ref.latitude + near(gen), ref.longitude + near(gen), 1000});
+                           exact.process(ac);
+                           const std::string expected = ac.get_serialized();
+                           local.process(ac);
+                           const std::string actual = ac.get_serialized();
+                           boost::smatch e;
+                           boost::smatch a;
+                           assertTrue(boost::regex_search(expected, e, helper::pflauRe));
+                           assertTrue(boost::regex_search(actual, a, helper::pflauRe));
+                           const int bearing = std::abs(std::stoi(e.str(1)) - std::stoi(a.str(1)));
+                           assertTrue(bearing <= 1 || bearing == 359);
+                           assertTrue(std::abs(std::stoi(e.str(3)) - std::stoi(a.str(3))) <= 1);
+                           assertTrue(boost::regex_search(expected, e, helper::pflaaRe));
+                           assertTrue(boost::regex_search(actual, a, helper::pflaaRe));
+                           assertTrue(std::abs(std::stoi(e.str(1)) - std::stoi(a.str(1))) <= 1);
+                           assertTrue(std::abs(std::stoi(e.str(2)) - std::stoi(a.str(2))) <= 1);
+                       }
+                   }
+               })
+        ->test("haversine beyond radius", [] {
+            const std::int32_t max = std::numeric_limits<std::int32_t>::max();
+            AircraftProcessor  exact;
+            AircraftProcessor  local(max, 1000);
+            Aircraft           ac;
+            ac.set_id(0xBBBBBB);
+            ac.set_fullInfo(false);
+            ac.set_position({49.1, 8.1, 1000});
+            exact.referTo({49.0, 8.0, 0}, 1013.25);
+            local.referTo({49.0, 8.0, 0}, 1013.25);
+            exact.process(ac);
+            const std::string expected = ac.get_serialized();
+            local.process(ac);
+            assertEqStr(ac.get_serialized(), expected);
+        });
 }
@@ -19,9 +19,129 @@
  }
  */
 
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include "config/Configuration.h"
+#include "config/Properties.h"
+#include "data/AircraftData.h"
+#include "data/GpsData.h"
+#include "feed/AprscFeed.h"
+#include "feed/SbsFeed.h"
+#include "object/GpsPosition.h"
+#include "object/TimeStamp.hpp"
+#include "object/impl/DateTimeImplBoost.h"
+#include "util/Metrics.h"
+
 #include "helper.hpp"
 
 using namespace sctf;
+using namespace feed;
+using namespace object;
+
+namespace
+{
+config::Properties feedProperties(const std::string& login = "user", bool autoFilter = false)
+{
+    boost::property_tree::ptree tree;
+    tree.add(KV_KEY_HOST, "localhost");
+    tree.add(KV_KEY_PORT, "1234");
+    tree.add(KV_KEY_LOGIN, login);
+    if (autoFilter)
+    {
+        tree.add(KV_KEY_AUTO_FILTER, "y");
+        tree.add(KV_KEY_FILTER_TERMS, "t/o");
+    }
+    return config::Properties(std::move(tree));
+}
+
+void moveTo(data::GpsData& data, double latitude, std::int32_t seconds)
+{
+    GpsPosition pos({latitude, 8.0, 0}, 48.0);
+    pos.set_timeStamp(TimeStamp<timestamp::DateTimeImplBoost>(helper::timePlus(seconds),
+                                                              timestamp::Format::HHMMSS));
+    data.update(std::move(pos));
+}
+}  // namespace
 
 void test_feed(test::TestSuitesRunner& runner)
-{}
+{
+    describe<AprscFeed>("process batch", runner)
+        ->test("aprs",
+               [] {
+                   auto        data = std::make_shared<data::AircraftData>(0);
+                   AprscFeed   feed("aprs", feedProperties(), data, 100000, nullptr, 0);
+                   std::string ac1 =
+                       "FLRAAAAAA>APRS,qAS,XXXX:/201131h4900.00N/00800.00E'180/090/A=002000 id0AAAAAAA +010fpm +0.3rot\r\n";
+                   std::string ac2 =
+                       "FLRBBBBBB>APRS,qAS,XXXX:/201131h4900.00N/00800.00E'180/090/A=002000 id0ABBBBBB +010fpm +0.3rot\r\n";
+                   std::vector<::util::StringView> lines = {
+                       ::util::StringView(ac1), "# aprsc 2.1.4\r\n", ::util::StringView(ac2)};
+                   std::uint64_t skipped = feed.get_metrics().linesSkipped.get();
+                   assertTrue(feed.processBatch(lines));
+                   assertEquals(data->get_queueDepth(), 2u);
+                   assertEquals(feed.get_metrics().linesSkipped.get(), skipped + 1);
+                   assertTrue(feed.process(ac1));
+                   assertEquals(data->get_queueDepth(), 3u);
+               })
+        ->test("sbs", [] {
+            auto        data = std::make_shared<data::AircraftData>(0);
+            SbsFeed     feed("sbs", feedProperties(), data, 100000);
+            std::string ac1 =
+                "MSG,3,0,0,AAAAAA,0,2017/02/16,20:11:30.772,2017/02/16,20:11:30.772,,3281,,,49.000000,8.000000,,,,,,0\r\n";
+            std::vector<::util::StringView> lines = {"MSG,4,0,0,AAAAAA\r\n",
+                                                     ::util::StringView(ac1)};
+            std::uint64_t skipped = feed.get_metrics().linesSkipped.get();
+            assertTrue(feed.processBatch(lines));
+            assertEquals(data->get_queueDepth(), 1u);
+            assertEquals(feed.get_metrics().linesSkipped.get(), skipped + 1);
+            assertEquals(data->flush(), 1u);
+        });
+
+    describe<AprscFeed>("generate filter", runner)
+        ->test("range and terms",
+               [] {
+                   auto data = std::make_shared<data::AircraftData>(0);
+                   auto gps  = std::make_shared<data::GpsData>(GpsPosition({49.0, 8.0, 0}, 48.0),
+                                                              false);
+                   AprscFeed feed("aprs", feedProperties("user", true), data, 100000, gps, 40000);
+                   assertTrue(feed.hasFilter());
+                   assertEquals(feed.get_filter(), std::string("filter r/49.0000/8.0000/50 t/o"));
+               })
+        ->test("follow position beyond margin",
+               [] {
+                   auto data = std::make_shared<data::AircraftData>(0);
+                   auto gps  = std::make_shared<data::GpsData>(GpsPosition({49.0, 8.0, 0}, 48.0),
+                                                              false);
+                   AprscFeed   feed("aprs", feedProperties("user", true), data, 100000, gps, 40000);
+                   std::string filter = feed.get_filter();
+                   moveTo(*gps, 49.05, -2);
+                   assertEquals(feed.get_filter(), filter);
+                   moveTo(*gps, 49.2, -1);
+                   assertEquals(feed.get_filter(), std::string("filter r/49.2000/8.0000/50 t/o"));
+               })
+        ->test("only terms without max distance",
+               [] {
+                   auto data = std::make_shared<data::AircraftData>(0);
+                   auto gps  = std::make_shared<data::GpsData>(GpsPosition({49.0, 8.0, 0}, 48.0),
+                                                              false);
+                   AprscFeed feed("aprs", feedProperties("user", true), data, 100000, gps,
+                                  std::numeric_limits<std::int32_t>::max());
+                   assertEquals(feed.get_filter(), std::string("filter t/o"));
+               })
+        ->test("keep given filter", [] {
+            auto      data = std::make_shared<data::AircraftData>(0);
+            auto      gps  = std::make_shared<data::GpsData>();
+            AprscFeed given("aprs", feedProperties("user pass -1 filter r/1/2/3", true), data,
+                            100000, gps, 40000);
+            AprscFeed none("aprs", feedProperties(), data, 100000, gps, 40000);
+            assertFalse(given.hasFilter());
+            assertFalse(none.hasFilter());
+            assertEquals(none.get_filter(), std::string());
+        });
+}
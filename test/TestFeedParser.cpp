@@ -19,11 +19,14 @@
  }
  */
 
+#include <cstddef>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "feed/parser/AprsParser.h"
 #include "feed/parser/AtmosphereParser.h"
+#include "feed/parser/Classifier.h"
 #include "feed/parser/GpsParser.h"
 #include "feed/parser/SbsParser.h"
 #include "feed/parser/WindParser.h"
@@ -49,7 +52,7 @@ void test_feed_parser(test::TestSuitesRunner& runner)
                 sbsParser.unpack(
                     "MSG,3,0,0,AAAAAA,0,2017/02/16,20:11:30.772,2017/02/16,20:11:30.772,,1000,,,49.000000,8.000000,,,,,,0",
                     ac);
-                assertEqStr(ac.get_id(), "AAAAAA");
+                assertEquals(ac.get_id(), 0xAAAAAAu);
                 assertEquals(ac.get_targetType(), object::Aircraft::TargetType::TRANSPONDER);
                 assertEquals(ac.get_position().altitude, math::doubleToInt(math::FEET_2_M * 1000));
                 assertEquals(ac.get_position().latitude, 49.0);
@@ -78,6 +81,12 @@ void test_feed_parser(test::TestSuitesRunner& runner)
                 assertFalse(sbsParser.unpack(
                     "MSG,3,0,0,0,2017/02/16,20:11:30.772,2017/02/16,20:11:30.772,,100#0,,,,,,,,,,0",
                     ac));
+                assertFalse(sbsParser.unpack(
+                    "MSG,3,0,0,AAAAAA,0,2017/02/16,20:11:30.772,2017/02/16,20:11:30.772,,1000,,,4.9e1,8.000000,,,,,,0",
+                    ac));
+                assertFalse(sbsParser.unpack(
+                    "MSG,3,0,0,AAAAAA,0,2017/02/16,20:11:30.772,2017/02/16,20:11:30.772,,1000,,,49.000000, 8.000000,,,,,,0",
+                    ac));
                 assertFalse(sbsParser.unpack("", ac));
             })
         ->test("filter height", []() {
@@ -107,13 +116,39 @@ void test_feed_parser(test::TestSuitesRunner& runner)
                 assertTrue(aprsParser.unpack(
                     "FLRAAAAAA>APRS,qAS,XXXX:/074548h4900.00N/00800.00W'000/000/A=000000 id0AAAAAAA +000fpm +0.0rot 5.5dB 3e -4.3kHz",
                     ac));
-                assertEqStr(ac.get_id(), "AAAAAA");
+                assertEquals(ac.get_id(), 0xAAAAAAu);
                 assertEquals(ac.get_targetType(), object::Aircraft::TargetType::FLARM);
                 assertEquals(ac.get_position().altitude, 0);
                 assertEquals(ac.get_position().latitude, 49.0);
                 assertEquals(ac.get_position().longitude, -8.0);
                 assertTrue(ac.get_fullInfo());
             })
+        ->test(
+            "parse fields",
+            []() {
+                AprsParser aprsParser;
+                object::Aircraft ac;
+                assertTrue(aprsParser.unpack(
+                    "FLRAAAAAA>APRS,qAS,XXXX:/100715h4930.00S\\00815.00E^276/014/A=001000 !W07! id22BBBBBB -019fpm +3.7rot 37.8dB 0e -51.2kHz gps2x4",
+                    ac));
+                assertEquals(ac.get_id(), 0xBBBBBBu);
+                assertEquals(ac.get_idType(), object::Aircraft::IdType::FLARM);
+                assertEquals(ac.get_aircraftType(),
+                             object::Aircraft::AircraftType::POWERED_AIRCRAFT);
+                assertEquals(ac.get_position().latitude, -49.5);
+                assertEquals(ac.get_position().longitude, 8.25);
+                assertEquals(ac.get_position().altitude,
+                             math::doubleToInt(1000.0 * math::FEET_2_M));
+                assertEquals(ac.get_movement().heading, 276.0);
+                assertEquals(ac.get_movement().gndSpeed, 14.0 * math::KTS_2_MS);
+                assertEquals(ac.get_movement().climbRate, -19.0 * math::FPM_2_MS);
+                assertTrue(ac.get_fullInfo());
+                object::Aircraft ac2;
+                assertTrue(aprsParser.unpack(
+                    "FLRAAAAAA>APRS,qAS,XXXX:/100715h4900.00N/00800.00E'/A=000000 !W19! id06AAAAAA",
+                    ac2));
+                assertFalse(ac2.get_fullInfo());
+            })
         ->test(
             "invalid msg",
             []() {
@@ -208,4 +243,54 @@ void test_feed_parser(test::TestSuitesRunner& runner)
             assertFalse(
                 gpsParser.unpack("$GPGGA,183552,N,00815.7555,E,1,05,1,105,M,48.0,M,,*\r\n", pos));
         });
+
+    describe("classify", runner)
+        ->test("aprs at any offset",
+               []() {
+                   AprsParser                     aprsParser;
+                   object::Aircraft               ac;
+                   const std::vector<std::string> aircrafts = {
+                       ">APRS,qAS,XXXX:/100715h4900.00N/00800.00E'/A=000000 !W19! id06AAAAAA",
+                       ">APRS,qAS,XXXX:/074548h4900.00N/00800.00W'000/000/A=000000 "
+                       "id0AAAAAAA +000fpm +0.0rot 5.5dB 3e -4.3kHz\r\n"};
+                   // shift the markers across the blocks of the vectorized search
+                   for (std::size_t i = 1; i < 40; ++i)
+                   {
+                       for (const auto& it : aircrafts)
+                       {
+                           std::string line = std::string(i, 'F') + it;
+                           assertTrue(aprsParser.unpack(line, ac));
+                           assertEquals(classifyAprs(::util::StringView(line)),
+                                        LineType::AIRCRAFT);
+                       }
+                   }
+               })
+        ->test("aprs others",
+               []() {
+                   assertEquals(
+                       classifyAprs(
+                           "Valhalla>APRS,TCPIP*,qAC,GLIDERN2:/074555h4900.00NI00800.00E&/A=000000 "
+                           "CPU:4.0 RAM:242.7/458.8MB NTP:0.8ms/-28.6ppm +56.2C RF:+38+2.4ppm/+1.7dB"),
+                       LineType::BEACON);
+                   assertEquals(classifyAprs("Valhalla>APRS,TCPIP*,qAC,GLIDERN2:>074555h v0.2.7 "
+                                             "id0AAAAAAA /A=000000"),
+                                LineType::BEACON);
+                   assertEquals(classifyAprs("FLRAAAAAA>APRS,qAS,XXXX:/100715z4900.00N/"
+                                             "00800.00E'/A=000000 !W19! id06AAAAAA"),
+                                LineType::BEACON);
+                   assertEquals(classifyAprs("# aprsc 2.0.14-g28c5a6a 29 Jun 2014 07:46:15 GMT"),
+                                LineType::COMMENT);
+                   assertEquals(classifyAprs("garbage:/100715h/A= id"), LineType::GARBAGE);
+                   assertEquals(classifyAprs(""), LineType::GARBAGE);
+               })
+        ->test("sbs and nmea", []() {
+            assertTrue(isSbsPosition("MSG,3,0,0,AAAAAA,0"));
+            assertFalse(isSbsPosition("MSG,4,0,0,AAAAAA,0"));
+            assertFalse(isSbsPosition("MSG,3"));
+            assertTrue(isNmea("$GPGGA,183552,5000.0466,N*49\r\n", "GGA"));
+            assertTrue(isNmea("$GNGGA,", "GGA"));
+            assertFalse(isNmea("$GPRMC,183552,A*6A\r\n", "GGA"));
+            assertFalse(isNmea("$WIMWV", "MWV"));
+            assertFalse(isNmea("WIMWV,242.8,R", "MWV"));
+        });
 }
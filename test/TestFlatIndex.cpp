@@ -0,0 +1,80 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+
+#include "util/FlatIndex.h"
+
+#include "helper.hpp"
+
+using namespace sctf;
+
+void test_flat_index(test::TestSuitesRunner& runner)
+{
+    describe<::util::FlatIndex>("flat index", runner)
+        ->test("set, find and erase",
+               []() {
+                   ::util::FlatIndex index;
+                   assertEquals(index.find(0xAAAAAA), ::util::FlatIndex::NONE);
+                   index.set(0xAAAAAA, 1);
+                   index.set(0x1BBBBBB, 2);
+                   index.set(0xAAAAAA, 3);
+                   assertEquals(index.get_size(), 2u);
+                   assertEquals(index.find(0xAAAAAA), 3u);
+                   assertEquals(index.find(0x1BBBBBB), 2u);
+                   assertEquals(index.find(0xBBBBBB), ::util::FlatIndex::NONE);
+                   assertTrue(index.erase(0xAAAAAA));
+                   assertFalse(index.erase(0xAAAAAA));
+                   assertEquals(index.find(0xAAAAAA), ::util::FlatIndex::NONE);
+                   assertEquals(index.find(0x1BBBBBB), 2u);
+                   assertEquals(index.get_size(), 1u);
+               })
+        ->test("agree with a map under churn", []() {
+            std::mt19937                                 gen(42);
+            std::uniform_int_distribution<std::uint32_t> keys(0, 4095);
+            std::unordered_map<std::uint32_t, std::uint32_t> reference;
+            ::util::FlatIndex                                index;
+            index.reserve(100);
+            for (std::uint32_t i = 0; i < 200000; ++i)
+            {
+                // grow to about 2000 keys, then hold the size, with a lot of erased slots
+                const std::uint32_t key = keys(gen) << 8;
+                if (i % 3 == 0 || (i > 100000 && i % 2 == 0))
+                {
+                    assertEquals(index.erase(key), reference.erase(key) > 0);
+                }
+                else
+                {
+                    index.set(key, i);
+                    reference[key] = i;
+                }
+            }
+            assertEquals(index.get_size(), reference.size());
+            for (std::uint32_t key = 0; key < 4096; ++key)
+            {
+                const auto it = reference.find(key << 8);
+                assertEquals(index.find(key << 8),
+                             it == reference.end() ? ::util::FlatIndex::NONE : it->second);
+            }
+        });
+}
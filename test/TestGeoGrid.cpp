@@ -0,0 +1,88 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "util/GeoGrid.h"
+#include "util/math.hpp"
+
+#include "helper.hpp"
+
+using namespace sctf;
+
+void test_geo_grid(test::TestSuitesRunner& runner)
+{
+    describe<::util::GeoGrid>("cull by grid", runner)
+        ->test("contain all in range of a moved center",
+               []() {
+                   const double centers[][2] = {{49.0, 8.0},   {0.0, 179.99}, {-60.0, -180.0},
+                                                {89.8, 10.0},  {-89.9, 0.0},  {70.0, -100.0}};
+                   std::mt19937                           gen(42);
+                   std::uniform_real_distribution<double> offset(-1.5, 1.5);
+                   std::uniform_real_distribution<double> move(-0.03, 0.03);
+                   for (const auto& center : centers)
+                   {
+                       ::util::GeoGrid grid(40000, 5000);
+                       assertTrue(grid.moveTo(center[0], center[1]));
+                       const double latitude  = center[0] + move(gen) / 2.0;
+                       const double longitude = center[1] + move(gen) / 2.0;
+                       assertFalse(grid.moveTo(latitude, longitude));
+                       int inRange = 0;
+                       for (int i = 0; i < 20000; ++i)
+                       {
+                           const double lat =
+                               std::max(-90.0, std::min(90.0, latitude + offset(gen)));
+                           const double lon = std::remainder(
+                               longitude + offset(gen) / std::cos(math::radian(lat)), 360.0);
+                           const double d = math::distance(latitude, longitude, lat, lon);
+                           if (d <= 40000.0)
+                           {
+                               assertTrue(grid.contains(lat, lon));
+                               ++inRange;
+                           }
+                           else if (d > 100000.0)
+                           {
+                               assertFalse(grid.contains(lat, lon));
+                           }
+                       }
+                       assertTrue(inRange > 100);
+                   }
+               })
+        ->test("rebuild beyond margin",
+               []() {
+                   ::util::GeoGrid grid(40000, 5000);
+                   assertTrue(grid.contains(-49.0, -8.0));
+                   assertTrue(grid.moveTo(49.0, 8.0));
+                   assertFalse(grid.contains(-49.0, -8.0));
+                   assertFalse(grid.moveTo(49.04, 8.0));
+                   assertTrue(grid.moveTo(49.05, 8.0));
+                   assertFalse(grid.contains(50.0, 8.0));
+                   assertTrue(grid.moveTo(50.0, 8.0));
+                   assertTrue(grid.contains(50.0, 8.0));
+               })
+        ->test("disabled without a filter", []() {
+            ::util::GeoGrid grid;
+            assertFalse(grid.moveTo(49.0, 8.0));
+            assertTrue(grid.contains(-49.0, -172.0));
+        });
+}
@@ -62,9 +62,15 @@ void test_math(test::TestSuitesRunner& runner)
                    assertEquals(math::icaoHeight(1013.25), 0);
                    assertEquals(math::icaoHeight(980.0), 281);
                })
-        ->test("checksum", []() {
-            assertEquals(math::checksum("", sizeof("")), 0);
-            assertEquals(math::checksum("\0", sizeof("\0")), 0);
-            assertEquals(math::checksum("$abc*", sizeof("$abc*")), 96);
+        ->test("checksum",
+               []() {
+                   assertEquals(math::checksum("", sizeof("")), 0);
+                   assertEquals(math::checksum("\0", sizeof("\0")), 0);
+                   assertEquals(math::checksum("$abc*", sizeof("$abc*")), 96);
+               })
+        ->test("distance", []() {
+            assertEquals(math::doubleToInt(math::distance(-0.1, 0.0, 0.1, 0.0)), 22239);
+            assertEquals(math::doubleToInt(math::distance(0.0, 179.9, 0.0, -179.9)), 22239);
+            assertEquals(math::distance(49.0, 8.0, 49.0, 8.0), 0.0);
         });
 }
@@ -0,0 +1,129 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include <chrono>
+#include <string>
+
+#include "object/Aircraft.h"
+#include "object/Wind.h"
+#include "util/Metrics.h"
+
+#include "helper.hpp"
+
+using namespace sctf;
+
+void test_metrics(test::TestSuitesRunner& runner)
+{
+    describe<::util::Metrics>("Metrics", runner)
+        ->test("register once",
+               [] {
+                   ::util::Metrics registry;
+                   assertEquals(&registry.feed("aprs"), &registry.feed("aprs"));
+                   assertTrue(&registry.feed("aprs") != &registry.feed("sbs"));
+                   assertEquals(&registry.gauge("g", "help"), &registry.gauge("g", "other"));
+               })
+        ->test("render text format",
+               [] {
+                   ::util::Metrics registry;
+                   registry.feed("aprs").linesRead.add(3);
+                   registry.feed("aprs").linesRejected.add();
+                   registry.gauge("vfrb_test", "A test").set(1.5);
+                   std::string text;
+                   registry.render(text);
+                   assertTrue(text.find("# TYPE vfrb_feed_read_lines_total counter\n") !=
+                              std::string::npos);
+                   assertTrue(text.find("vfrb_feed_read_lines_total{feed=\"aprs\"} 3\n") !=
+                              std::string::npos);
+                   assertTrue(text.find("vfrb_feed_rejected_lines_total{feed=\"aprs\"} 1\n") !=
+                              std::string::npos);
+                   assertTrue(text.find("# HELP vfrb_test A test\n# TYPE vfrb_test gauge\n"
+                                        "vfrb_test 1.5\n") != std::string::npos);
+               })
+        ->test("count updates", [] {
+            ::util::FeedMetrics feed;
+            object::Wind        wind(1);
+            object::Wind        update(2);
+            update.set_metrics(&feed);
+            assertTrue(wind.tryUpdate(std::move(update)));
+            object::Wind low(0);
+            low.set_metrics(&feed);
+            assertFalse(wind.tryUpdate(std::move(low)));
+            assertEquals(feed.updatesAccepted.get(), 1u);
+            assertEquals(feed.updatesRejected.get(), 1u);
+            assertEquals(feed.storeLatency.get_count(), 0u);
+        });
+    describe<::util::Histogram>("Histogram", runner)
+        ->test("log-linear buckets",
+               [] {
+                   assertEquals(::util::Histogram::bucketOf(0), 0u);
+                   assertEquals(::util::Histogram::bucketOf(3), 3u);
+                   assertEquals(::util::Histogram::bucketOf(4), 4u);
+                   assertEquals(::util::Histogram::bucketOf(9), 8u);
+                   assertEquals(::util::Histogram::bucketOf(10), 9u);
+                   assertEquals(::util::Histogram::boundOf(8), 10u);
+                   assertEquals(::util::Histogram::bucketOf(1000000000000u),
+                                static_cast<std::size_t>(HISTOGRAM_BUCKETS - 1));
+                   for (std::uint64_t micros = 4; micros < 100000; micros = micros * 3 / 2)
+                   {
+                       const std::size_t bucket = ::util::Histogram::bucketOf(micros);
+                       assertTrue(::util::Histogram::boundOf(bucket) > micros);
+                       assertTrue(::util::Histogram::boundOf(bucket - 1) <= micros);
+                   }
+               })
+        ->test("quantiles",
+               [] {
+                   ::util::Histogram histogram;
+                   assertEquals(histogram.quantile(0.5), 0u);
+                   histogram.observe(std::chrono::microseconds(2), 9);
+                   histogram.observe(std::chrono::milliseconds(1));
+                   histogram.observe(std::chrono::microseconds(-5));
+                   assertEquals(histogram.get_count(), 11u);
+                   assertEquals(histogram.get_sum(), 1018u);
+                   assertEquals(histogram.quantile(0.5), 3u);
+                   assertEquals(histogram.quantile(1.0), 1024u);
+               })
+        ->test("render histogram",
+               [] {
+                   ::util::Metrics registry;
+                   registry.feed("sbs").parseLatency.observe(std::chrono::microseconds(9), 2);
+                   std::string text;
+                   registry.render(text);
+                   const std::string series = "vfrb_feed_latency_seconds_bucket{feed=\"sbs\","
+                                              "stage=\"parse\",le=";
+                   assertTrue(text.find("# TYPE vfrb_feed_latency_seconds histogram\n") !=
+                              std::string::npos);
+                   assertTrue(text.find(series + "\"0.000010\"} 2\n") != std::string::npos);
+                   assertTrue(text.find(series + "\"+Inf\"} 2\n") != std::string::npos);
+                   assertTrue(text.find("vfrb_feed_latency_seconds_sum{feed=\"sbs\","
+                                        "stage=\"parse\"} 0.000018\n") != std::string::npos);
+                   assertEquals(registry.summarizeLatencies().size(), 1u);
+               })
+        ->test("record store latency", [] {
+            ::util::FeedMetrics feed;
+            object::Wind        wind(0);
+            object::Wind        update(0);
+            update.set_metrics(&feed);
+            update.set_received(std::chrono::steady_clock::now());
+            assertTrue(wind.tryUpdate(std::move(update)));
+            assertEquals(feed.storeLatency.get_count(), 1u);
+            assertTrue(wind.get_metrics() == &feed);
+        });
+}
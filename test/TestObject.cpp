@@ -19,7 +19,11 @@
  }
  */
 
+#include <cstdio>
+#include <string>
+
 #include "object/Aircraft.h"
+#include "object/AircraftRecord.h"
 #include "object/Atmosphere.h"
 #include "object/GpsPosition.h"
 #include "object/TimeStamp.hpp"
@@ -34,6 +38,21 @@ using namespace sctf;
 
 using TS = TimeStamp<DateTimeImplTest>;
 
+namespace
+{
+/**
+ * @brief Format a climb rate like the reports did with printf.
+ * @param value The climb rate
+ * @return the formatted climb rate
+ */
+std::string formatClimbRate(double value)
+{
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%3.1lf", value);
+    return buffer;
+}
+}  // namespace
+
 void test_object(test::TestSuitesRunner& runner)
 {
     describe<Object>("Basic Object tests", runner)
@@ -44,9 +63,10 @@ void test_object(test::TestSuitesRunner& runner)
                    assertEquals((++o).get_updateAge(), 1);
                })
         ->test("tryUpdate", [] {
-            Object o1;
-            Object o2(1);
-            Object o3(2);
+            // Wind applies the rules of Object only
+            Wind o1;
+            Wind o2(1);
+            Wind o3(2);
             o1.set_serialized("");
             o2.set_serialized("a");
             o3.set_serialized("b");
@@ -110,14 +130,37 @@ void test_object(test::TestSuitesRunner& runner)
                    assertTrue(t2 > t1);
                    assertFalse(t1 > t2);
                })
-        ->test("comparison - incremental day", [] {
+        ->test("comparison - incremental day",
+               [] {
+                   DateTimeImplTest::set_day(1);
+                   DateTimeImplTest::set_now(13, 0, 0);
+                   TS t1("120000", Format::HHMMSS);
+                   DateTimeImplTest::set_day(2);
+                   TS t2("110000", Format::HHMMSS);
+                   assertTrue(t2 > t1);
+                   assertFalse(t1 > t2);
+               })
+        ->test("comparison - ahead of clock",
+               [] {
+                   DateTimeImplTest::set_day(1);
+                   DateTimeImplTest::set_now(12, 0, 0);
+                   TS t1("120000", Format::HHMMSS);
+                   TS t2("120005", Format::HHMMSS);
+                   assertTrue(t2 > t1);
+                   assertFalse(t1 > t2);
+               })
+        ->test("tryParse", [] {
             DateTimeImplTest::set_day(1);
-            DateTimeImplTest::set_now(13, 0, 0);
-            TS t1("120000", Format::HHMMSS);
-            DateTimeImplTest::set_day(2);
-            TS t2("110000", Format::HHMMSS);
+            DateTimeImplTest::set_now(12, 0, 0);
+            TS t1("110000", Format::HHMMSS);
+            TS t2;
+            assertTrue(TS::tryParse("12:00:00.000", Format::HH_MM_SS_FFF, t2));
+            assertTrue(t2 > t1);
+            assertFalse(TS::tryParse("12:0a:00.000", Format::HH_MM_SS_FFF, t1));
+            assertFalse(TS::tryParse("12:00:00.0", Format::HH_MM_SS_FFF, t1));
+            assertFalse(TS::tryParse("12000", Format::HHMMSS, t1));
+            assertFalse(TS::tryParse("240000", Format::HHMMSS, t1));
             assertTrue(t2 > t1);
-            assertFalse(t1 > t2);
         });
 
     describe<GpsPosition>("Basic GpsPosition tests", runner)
@@ -188,4 +231,54 @@ void test_object(test::TestSuitesRunner& runner)
             a1.set_timeStamp(TimeStamp<DateTimeImplBoost>("120100", timestamp::Format::HHMMSS));
             assertTrue(a2.tryUpdate(std::move(a1)));
         });
+
+    describe<AircraftRecord>("Basic AircraftRecord tests", runner)
+        ->test("compact state",
+               [] {
+                   Aircraft a;
+                   a.set_id(0xAAAAAA);
+                   a.set_position({49.1234567, -8.7654321, 1000});
+                   a.set_movement({25.0, 359.6, -1.25});
+                   AircraftRecord r(a);
+                   assertEquals(r.get_id(), 0xAAAAAAu);
+                   assertEquals(r.get_position().latitude, 49.1234567);
+                   assertEquals(r.get_position().longitude, -8.7654321);
+                   assertEquals(r.get_position().altitude, 1000);
+                   assertEquals(r.get_gndSpeed(), 90);
+                   assertEquals(r.get_heading(), 360);
+                   assertEquals(r.get_climbRate(), -1.2);
+                   assertTrue(r.get_due());
+               })
+        ->test("climb rate rounded like printf",
+               [] {
+                   Aircraft a;
+                   for (double climb : {0.05, 0.15, 0.25, 0.35, 0.45, 0.55, 0.65, 0.75, 0.85,
+                                        0.95, 1.25, 2.35, -0.35, -1.45, -0.04, 0.0, -0.0})
+                   {
+                       a.set_movement({0.0, 0.0, climb});
+                       assertEqStr(formatClimbRate(AircraftRecord(a).get_climbRate()),
+                                   formatClimbRate(climb));
+                   }
+               })
+        ->test("update", [] {
+            Aircraft a1;
+            Aircraft a2;
+            a2.set_timeStamp(TimeStamp<DateTimeImplBoost>("120000", timestamp::Format::HHMMSS));
+            a2.set_targetType(Aircraft::TargetType::FLARM);
+            a2.set_position({49.0, 8.0, 1000});
+            AircraftRecord r1(a1);
+            AircraftRecord r2(a2);
+            r1.set_due(false);
+            ++r1;
+            assertTrue(r1.tryUpdate(r2));
+            assertTrue(r1.get_due());
+            assertEquals(r1.get_updateAge(), 0);
+            assertEquals(r1.get_position().altitude, 1000);
+            assertFalse(r2.tryUpdate(AircraftRecord(a1)));
+            a1.set_timeStamp(TimeStamp<DateTimeImplBoost>("120100", timestamp::Format::HHMMSS));
+            assertFalse(r2.tryUpdate(AircraftRecord(a1)));
+            r2.set_targetType(Aircraft::TargetType::TRANSPONDER);
+            assertTrue(r2.tryUpdate(AircraftRecord(a1)));
+            assertFalse(r2.tryUpdate(AircraftRecord(a1)));
+        });
 }
@@ -0,0 +1,83 @@
+/*
+ Copyright_License {
+
+ Copyright (C) 2016 VirtualFlightRadar-Backend
+ A detailed list of copyright holders can be found in the file "AUTHORS".
+
+ This program is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License version 3
+ as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ }
+ */
+
+#include <chrono>
+#include <thread>
+
+#include "util/Scheduler.h"
+
+#include "helper.hpp"
+
+using namespace sctf;
+using namespace std::chrono;
+
+void test_scheduler(test::TestSuitesRunner& runner)
+{
+    describe<::util::Scheduler>("schedule streams", runner)
+        ->test("due at wall-clock boundaries",
+               [] {
+                   ::util::Scheduler scheduler;
+                   const auto        stream = scheduler.add(milliseconds(50));
+                   for (int i = 0; i < 3; ++i)
+                   {
+                       assertFalse(scheduler.wait());
+                       assertTrue(scheduler.due(stream));
+                       assertFalse(scheduler.due(stream));
+                       const auto offset =
+                           duration_cast<milliseconds>(system_clock::now().time_since_epoch()) %
+                           milliseconds(50);
+                       assertTrue(offset < milliseconds(25));
+                   }
+               })
+        ->test("commensurable streams due together",
+               [] {
+                   ::util::Scheduler scheduler;
+                   const auto        fast   = scheduler.add(milliseconds(20));
+                   const auto        slow   = scheduler.add(milliseconds(60));
+                   int               cycles = 0;
+                   while (cycles < 2)
+                   {
+                       scheduler.wait();
+                       const bool fastDue = scheduler.due(fast);
+                       if (scheduler.due(slow))
+                       {
+                           assertTrue(fastDue);
+                           ++cycles;
+                       }
+                   }
+               })
+        ->test("wake on notify", [] {
+            ::util::Scheduler scheduler;
+            const auto        periodic = scheduler.add(seconds(60));
+            const auto        onChange = scheduler.add(seconds(0));
+            const auto        start    = steady_clock::now();
+            std::thread       notifier([&scheduler] {
+                std::this_thread::sleep_for(milliseconds(10));
+                scheduler.notify();
+                scheduler.notify();
+            });
+            assertTrue(scheduler.wait());
+            notifier.join();
+            assertTrue(steady_clock::now() - start < seconds(10));
+            assertFalse(scheduler.due(periodic));
+            assertFalse(scheduler.due(onChange));
+        });
+}
@@ -19,6 +19,11 @@
  }
  */
 
+#include <memory>
+#include <string>
+
+#include "server/Connection.hpp"
+#include "server/Message.h"
 #include "server/Server.hpp"
 
 #include "NetworkInterfaceImplTest.h"
@@ -27,6 +32,15 @@
 
 using namespace sctf;
 using namespace server;
+using namespace server::net;
+
+namespace
+{
+Message seal(std::shared_ptr<MessagePool> pool, std::string content)
+{
+    return pool->seal(content);
+}
+}  // namespace
 
 void test_server(test::TestSuitesRunner& runner)
 {
@@ -35,4 +49,80 @@ void test_server(test::TestSuitesRunner& runner)
         Server<SocketImplTest> server(ifc);
         server.run();
     });*/
+    describe<MessagePool>("Message pool", runner)
+        ->test("share and recycle",
+               [] {
+                   auto        pool    = MessagePool::create();
+                   std::string content = std::string(1000, 'x');
+                   Message     msg     = pool->seal(content);
+                   assertTrue(content.empty());
+                   Message copy = msg;
+                   assertEquals(&copy.get(), &msg.get());
+                   assertEquals(msg.get().size(), 1000u);
+                   msg  = Message();
+                   copy = Message();
+                   content.assign("y");
+                   msg = pool->seal(content);
+                   assertTrue(content.capacity() >= 1000u);
+                   assertEqStr(msg.get(), "y");
+               })
+        ->test("outlive pool", [] {
+            auto        pool    = MessagePool::create();
+            std::string content = "a";
+            Message     msg     = pool->seal(content);
+            pool.reset();
+            assertEqStr(msg.get(), "a");
+        });
+    describe<Connection<SocketImplTest>>("Connection send queue", runner)
+        ->test("write asynchronously",
+               [] {
+                   auto pool     = MessagePool::create();
+                   auto endpoint = std::make_shared<SocketImplTest::Endpoint>();
+                   auto conn = Connection<SocketImplTest>::create(SocketImplTest(1, endpoint), 4);
+                   assertTrue(conn->write(seal(pool, "a")));
+                   assertTrue(conn->write(seal(pool, "b")));
+                   assertTrue(conn->write(seal(pool, "c")));
+                   assertEquals(endpoint->received.size(), 1u);
+                   assertEqStr(endpoint->received[0], "a");
+                   endpoint->complete(true);
+                   assertEquals(endpoint->received.size(), 2u);
+                   assertEqStr(endpoint->received[1], "bc");
+                   endpoint->complete(true);
+                   assertFalse(bool(endpoint->pending));
+               })
+        ->test("drop oldest for slow client",
+               [] {
+                   auto pool     = MessagePool::create();
+                   auto endpoint = std::make_shared<SocketImplTest::Endpoint>();
+                   auto conn     = Connection<SocketImplTest>::create(
+                       SocketImplTest(1, endpoint), 3, SlowClientPolicy::DROP_OLDEST);
+                   for (int i = 0; i < 6; ++i)
+                   {
+                       assertTrue(conn->write(seal(pool, std::to_string(i))));
+                   }
+                   assertEquals(conn->get_drops(), 3u);
+                   endpoint->complete(true);
+                   endpoint->complete(true);
+                   assertEquals(endpoint->received.size(), 2u);
+                   assertEqStr(endpoint->received[0], "0");
+                   assertEqStr(endpoint->received[1], "45");
+               })
+        ->test("disconnect slow client",
+               [] {
+                   auto pool     = MessagePool::create();
+                   auto endpoint = std::make_shared<SocketImplTest::Endpoint>();
+                   auto conn     = Connection<SocketImplTest>::create(
+                       SocketImplTest(1, endpoint), 2, SlowClientPolicy::DISCONNECT);
+                   assertTrue(conn->write(seal(pool, "a")));
+                   assertTrue(conn->write(seal(pool, "b")));
+                   assertFalse(conn->write(seal(pool, "c")));
+               })
+        ->test("fail after write error", [] {
+            auto pool     = MessagePool::create();
+            auto endpoint = std::make_shared<SocketImplTest::Endpoint>();
+            auto conn     = Connection<SocketImplTest>::create(SocketImplTest(1, endpoint));
+            assertTrue(conn->write(seal(pool, "a")));
+            endpoint->complete(false);
+            assertFalse(conn->write(seal(pool, "b")));
+        });
 }
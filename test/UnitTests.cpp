@@ -31,9 +31,13 @@ TEST_FUNCTION(test_data_processor)
 TEST_FUNCTION(test_feed_parser)
 TEST_FUNCTION(test_object)
 TEST_FUNCTION(test_math)
+TEST_FUNCTION(test_geo_grid)
+TEST_FUNCTION(test_flat_index)
 TEST_FUNCTION(test_client)
 TEST_FUNCTION(test_server)
 TEST_FUNCTION(test_feed)
+TEST_FUNCTION(test_metrics)
+TEST_FUNCTION(test_scheduler)
 
 int main(int, char**)
 {
@@ -48,9 +52,13 @@ int main(int, char**)
     test_feed_parser(runner);
     test_object(runner);
     test_math(runner);
+    test_geo_grid(runner);
+    test_flat_index(runner);
     test_feed(runner);
     test_client(runner);
     test_server(runner);
+    test_metrics(runner);
+    test_scheduler(runner);
 
     return rep->report(runner) > 0 ? 1 : 0;
 }
@@ -22,8 +22,12 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
+#include <memory>
 #include <string>
+#include <vector>
 
+#include "server/Message.h"
 #include "util/defines.h"
 
 namespace server
@@ -35,18 +39,29 @@ class SocketImplTest
 public:
     MOVABLE_BUT_NOT_COPYABLE(SocketImplTest)
 
+    struct Endpoint
+    {
+        std::vector<std::string>  received;
+        std::function<void(bool)> pending;
+
+        void complete(bool success);
+    };
+
     explicit SocketImplTest(int&& socket);
+    SocketImplTest(int&& socket, std::shared_ptr<Endpoint> endpoint);
     ~SocketImplTest() noexcept;
 
     std::string get_address() const;
-    bool        write(const std::string& msg);
+    void        asyncWrite(const std::vector<Message>&      msgs,
+                           const std::function<void(bool)>& callback);
     void        close();
     int&        get();
 
 private:
-    std::string  m_buffer;
-    std::int32_t m_socket;
-    std::string  m_address;
+    std::string               m_buffer;
+    std::int32_t              m_socket;
+    std::string               m_address;
+    std::shared_ptr<Endpoint> m_endpoint;
 
 public:
     GETTER_CR(buffer)